@@ -8,6 +8,10 @@
 #include "simulation/Region.h"
 #include "simulation/SpeciesTemplate.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 // ============================================================
 // 构造和析构
 // ============================================================
@@ -21,12 +25,16 @@ SimulationWrapper::SimulationWrapper()
     , pop_system(nullptr)
     , creature_system(nullptr)
     , conversion_system(nullptr)
+    , effect_bus(nullptr)
+    , prewarm_enabled(true)
+    , mq_distance(150.0f)
     , initialized(false)
 {
 }
 
 SimulationWrapper::~SimulationWrapper() {
     // 清理所有 C++ 对象
+    if (effect_bus) delete effect_bus;
     if (conversion_system) delete conversion_system;
     if (creature_system) delete creature_system;
     if (pop_system) delete pop_system;
@@ -64,6 +72,17 @@ void SimulationWrapper::initialize() {
     creature_system = new CreatureSystem(*scheduler);
     conversion_system = new ConversionSystem(*scheduler, *state);
 
+    // 默认每帧最多用2ms生成HQ个体，其余分摊到后续帧；预热只用剩余时间且每帧最多32个
+    ConversionSystem::Budget budget;
+    budget.max_microseconds = 2000;
+    budget.max_warming_spawns_per_frame = 32;
+    conversion_system->set_budget(budget);
+    conversion_system->set_budget_manager(&hq_budget);
+
+    // Effect总线：个体索引按Effect增量更新
+    effect_bus = new ecs::EffectBus();
+    creature_index.attach(*effect_bus, *registry);
+
     // 初始化世界种群
     _initialize_world_populations();
 
@@ -78,38 +97,246 @@ void SimulationWrapper::update(float delta) {
         return;
     }
 
-    // 清空Effect记录
+    // 清空Effect记录（保留本帧所有子步的Effect）
     recorder->clear();
 
+    uint32_t steps = clock.advance(delta);
+    for (uint32_t i = 0; i < steps; ++i) {
+        _step(clock.get_fixed_dt());
+    }
+}
+
+void SimulationWrapper::_step(float dt) {
     // 1. HQ/LQ 转换检查（基于target_mode）
     conversion_system->update_region_modes();
 
-    // 2. 更新LQ区域的种群
-    pop_system->update(delta);
+    // 2. 更新LQ区域的种群（按距离多速率调度），之前先更新所有Region的食物
+    pop_system->update_food(dt);
+    pop_system->update_regions(region_ticks.plan(*state, dt));
+
+    // LQ种群迁移（整个大陆一次稀疏矩阵乘）和MQ区域的代表个体样本每步更新
+    pop_system->update_migration(dt);
+    pop_system->update_samples(dt);
 
     // 3. 更新HQ区域的个体
-    creature_system->update(delta);
+    creature_system->update(dt);
+
+    // 4. 长期运行的Process（Buff/工单等协程）
+    scheduler->execute_long_running_processes(dt);
+
+    // 5. 输出窗口已满的合并Effect，分发本步Effect给订阅者
+    recorder->end_tick();
+    effect_bus->publish(*recorder);
+
+    // 6. 时间推进
+    state->current_time += dt;
+}
+
+void SimulationWrapper::set_fixed_timestep(float dt) {
+    if (dt <= 0.0f) {
+        UtilityFunctions::push_warning("Fixed timestep must be positive: ", dt);
+        return;
+    }
+    clock.set_fixed_dt(dt);
+}
+
+float SimulationWrapper::get_fixed_timestep() const {
+    return clock.get_fixed_dt();
+}
+
+void SimulationWrapper::set_max_substeps(int n) {
+    clock.set_max_substeps(static_cast<uint32_t>(std::max(1, n)));
+}
+
+int SimulationWrapper::get_max_substeps() const {
+    return static_cast<int>(clock.get_max_substeps());
+}
+
+float SimulationWrapper::get_interpolation_alpha() const {
+    return clock.interpolation_alpha();
+}
+
+int SimulationWrapper::get_steps_last_frame() const {
+    return static_cast<int>(clock.get_steps_last_frame());
+}
+
+void SimulationWrapper::set_event_driven_lifecycle(bool enabled) {
+    if (!initialized) return;
+    scheduler->set_lifecycle_mode(enabled ? process::LifecycleMode::EventDriven
+                                          : process::LifecycleMode::Sweep);
+}
+
+bool SimulationWrapper::is_event_driven_lifecycle() const {
+    if (!initialized) return false;
+    return scheduler->get_lifecycle_mode() == process::LifecycleMode::EventDriven;
+}
+
+void SimulationWrapper::set_worker_count(int workers) {
+    if (!initialized) return;
+    scheduler->set_worker_count(static_cast<uint32_t>(std::max(1, workers)));
+}
+
+int SimulationWrapper::get_worker_count() const {
+    if (!initialized) return 1;
+    return static_cast<int>(scheduler->get_worker_count());
+}
+
+void SimulationWrapper::set_effect_coalescing(bool enabled, int window_ticks, float epsilon) {
+    if (!initialized) return;
+
+    ecs::CoalesceConfig config;
+    config.enabled = enabled;
+    config.window_ticks = static_cast<uint32_t>(std::max(1, window_ticks));
+    config.default_epsilon = std::max(0.0f, epsilon);
+    recorder->set_coalescing(config);
+}
+
+void SimulationWrapper::set_conversion_budget(int max_spawns_per_frame, int max_microseconds) {
+    if (!initialized) return;
+
+    ConversionSystem::Budget budget = conversion_system->get_budget();
+    budget.max_spawns_per_frame = static_cast<uint32_t>(std::max(0, max_spawns_per_frame));
+    budget.max_microseconds = static_cast<uint32_t>(std::max(0, max_microseconds));
+    conversion_system->set_budget(budget);
+}
+
+void SimulationWrapper::set_hq_prewarm(bool enabled, float horizon_seconds) {
+    prewarm_enabled = enabled;
+    camera_predictor.clear();
+
+    CameraPredictor::Config config = camera_predictor.get_config();
+    config.horizon_seconds = std::max(0.0f, horizon_seconds);
+    camera_predictor.set_config(config);
+}
+
+void SimulationWrapper::set_food_dynamics(bool enabled, float regrowth_rate, float consumption_rate) {
+    if (!initialized) return;
 
-    // 4. 时间推进
-    state->current_time += delta;
+    process::dynamics::FoodDynamics::Config config = scheduler->get_food_dynamics().get_config();
+    config.enabled = enabled;
+    config.regrowth_rate = std::max(0.0f, regrowth_rate);
+    config.consumption_rate = std::max(0.0f, consumption_rate);
+    scheduler->get_food_dynamics().set_config(config);
+
+    // 关闭时恢复满食物，承载力回到静态模型
+    if (!enabled) {
+        for (const auto& [id, region] : state->get_all_regions()) {
+            state->get_region(id).value().get().current_food = region.food_capacity;
+        }
+    }
+}
+
+void SimulationWrapper::set_lq_migration(float rate, float max_outflow) {
+    if (!initialized) return;
+
+    process::dynamics::PopulationDiffusion::Config config;
+    config.rate = std::max(0.0f, rate);
+    config.max_outflow = std::clamp(max_outflow, 0.0f, 1.0f);
+    scheduler->get_diffusion().set_config(config);
+}
+
+void SimulationWrapper::set_mq_tier(float distance, int max_samples, int individuals_per_sample) {
+    mq_distance = std::max(0.0f, distance);
+    if (!initialized) return;
+
+    process::UpdateRepresentativeSamples::Options options;
+    options.max_samples = static_cast<uint32_t>(std::max(1, max_samples));
+    options.individuals_per_sample = static_cast<uint32_t>(std::max(1, individuals_per_sample));
+    scheduler->set_sample_options(options);
+}
+
+void SimulationWrapper::set_dormant_cache(int max_kb, float max_dormant_days) {
+    if (!initialized) return;
+
+    process::DormantCreatureCache::Config config;
+    config.max_bytes = static_cast<size_t>(std::max(0, max_kb)) * 1024;
+    config.max_dormant_time = std::max(0.0f, max_dormant_days);
+    scheduler->get_dormant_cache().set_config(config);
+}
+
+void SimulationWrapper::set_hq_budget(int total_slots, int max_per_population) {
+    HqBudgetManager::Config config = hq_budget.get_config();
+    config.total_slots = static_cast<uint32_t>(std::max(0, total_slots));
+    config.max_per_population = static_cast<uint32_t>(std::max(0, max_per_population));
+    hq_budget.set_config(config);
+}
+
+void SimulationWrapper::set_region_importance(int region_id, float importance) {
+    region_importance[static_cast<uint32_t>(region_id)] = std::max(0.0f, importance);
+}
+
+void SimulationWrapper::set_region_visible(int region_id, bool visible) {
+    region_visible[static_cast<uint32_t>(region_id)] = visible;
 }
 
 void SimulationWrapper::set_camera_position(Vector3 pos) {
     if (!initialized) return;
+    _update_viewers({pos});
+}
+
+void SimulationWrapper::set_camera_positions(PackedVector3Array positions) {
+    if (!initialized || positions.size() == 0) return;
+
+    std::vector<Vector3> viewers;
+    for (int64_t i = 0; i < positions.size(); ++i) {
+        viewers.push_back(positions[i]);
+    }
+    _update_viewers(viewers);
+}
+
+void SimulationWrapper::_update_viewers(const std::vector<Vector3>& viewers) {
+    // 找到各观察者当前所在的Region
+    std::vector<uint32_t> current_regions;
+    for (const auto& pos : viewers) {
+        current_regions.push_back(CoordinateMapper::find_nearest_region(pos));
+    }
 
-    // 找到玩家当前所在的Region
-    uint32_t current_region = CoordinateMapper::find_nearest_region(pos);
+    // 按主相机（第一个观察者）速度预测即将进入的Region
+    const Vector3& primary = viewers.front();
+    double now = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    camera_predictor.add_sample(now, primary.x, primary.z);
+
+    std::vector<uint32_t> warming;
+    if (prewarm_enabled) {
+        warming = camera_predictor.predict_regions([](float x, float z) {
+            return CoordinateMapper::find_nearest_region(Vector3(x, 0.0f, z));
+        });
+    }
 
     // 设置所有Region的target_mode
-    // 玩家所在Region → HQ，其他Region → LQ
+    // 观察者所在Region → HQ，预计即将进入的Region → 预热，中距离Region → MQ，其他Region → LQ
+    // HQ和预热Region向预算管理器申请个体名额（预热按不可见处理，优先级较低）
+    hq_budget.clear_requests();
     auto& all_regions = const_cast<std::map<uint32_t, Region>&>(state->get_all_regions());
 
     for (auto& [region_id, region] : all_regions) {
-        if (region_id == current_region) {
+        float distance = std::numeric_limits<float>::max();
+        for (const auto& pos : viewers) {
+            distance = std::min(distance, CoordinateMapper::calculate_camera_distance(pos, region_id));
+        }
+
+        auto importance_it = region_importance.find(region_id);
+        auto visible_it = region_visible.find(region_id);
+        HqRegionPriority priority;
+        priority.distance = distance;
+        priority.importance = importance_it != region_importance.end() ? importance_it->second : 1.0f;
+        priority.visible = visible_it != region_visible.end() ? visible_it->second : true;
+
+        if (std::find(current_regions.begin(), current_regions.end(), region_id) != current_regions.end()) {
             region.target_mode = Region::Mode::HQ;
+            hq_budget.request(region_id, priority);
+        } else if (std::find(warming.begin(), warming.end(), region_id) != warming.end()) {
+            region.target_mode = Region::Mode::Warming;
+            priority.visible = false;
+            hq_budget.request(region_id, priority);
+        } else if (distance < mq_distance) {
+            region.target_mode = Region::Mode::MQ;
         } else {
             region.target_mode = Region::Mode::LQ;
         }
+
+        // 更新多速率调度的距离（决定LQ/MQ区域的更新周期）
+        region_ticks.set_region_distance(region_id, distance);
     }
 }
 
@@ -145,16 +372,43 @@ Dictionary SimulationWrapper::get_region(int region_id) {
 
     if (!initialized) return result;
 
-    try {
-        const Region& region = state->get_region(static_cast<uint32_t>(region_id));
-        result = _region_to_dict(region_id, region);
-    } catch (...) {
+    auto region_result = state->get_region(static_cast<uint32_t>(region_id));
+    if (region_result.is_err()) {
         UtilityFunctions::push_error("Invalid region_id: ", region_id);
+        return result;
     }
+    result = _region_to_dict(region_id, region_result.value().get());
+
+    return result;
+}
+
+int SimulationWrapper::get_region_hops(int from_region, int to_region) const {
+    if (!initialized) return -1;
+    uint16_t hops = state->get_routing().hops(static_cast<uint32_t>(from_region), static_cast<uint32_t>(to_region));
+    return hops == RegionRoutingTable::kUnreachable ? -1 : static_cast<int>(hops);
+}
+
+PackedInt32Array SimulationWrapper::get_region_path(int from_region, int to_region) const {
+    PackedInt32Array result;
+    if (!initialized) return result;
 
+    for (uint32_t region_id : state->get_routing().path(static_cast<uint32_t>(from_region),
+                                                        static_cast<uint32_t>(to_region))) {
+        result.push_back(static_cast<int32_t>(region_id));
+    }
     return result;
 }
 
+bool SimulationWrapper::connect_regions(int region_a, int region_b) {
+    if (!initialized) return false;
+    return state->connect_regions(static_cast<uint32_t>(region_a), static_cast<uint32_t>(region_b)).is_ok();
+}
+
+bool SimulationWrapper::disconnect_regions(int region_a, int region_b) {
+    if (!initialized) return false;
+    return state->disconnect_regions(static_cast<uint32_t>(region_a), static_cast<uint32_t>(region_b)).is_ok();
+}
+
 // ============================================================
 // Creature 查询 API
 // ============================================================
@@ -164,22 +418,8 @@ TypedArray<Dictionary> SimulationWrapper::get_creatures_in_region(int region_id)
 
     if (!initialized) return result;
 
-    // 遍历所有拥有 Position 组件的实体
-    const auto& entities = registry->view<component::Position>();
-
-    for (EntityId entity_id : entities) {
-        const auto& pos = registry->get_component<component::Position>(entity_id);
-
-        // 过滤：只返回指定Region的Creature
-        if (pos.region_id != static_cast<uint32_t>(region_id)) {
-            continue;
-        }
-
-        // 只处理Creature类型实体
-        if (!registry->has_component<component::SpeciesRef>(entity_id)) {
-            continue;
-        }
-
+    // 由Effect总线维护的Region索引，不遍历所有Position组件
+    for (EntityId entity_id : creature_index.creatures_in(static_cast<uint32_t>(region_id))) {
         result.append(_creature_to_dict(entity_id));
     }
 
@@ -210,7 +450,23 @@ TypedArray<Dictionary> SimulationWrapper::get_populations_in_region(int region_i
         pop_data["species_id"] = static_cast<int>(pop.species_id);
         pop_data["region_id"] = static_cast<int>(pop.region_id);
         pop_data["count"] = static_cast<int>(pop.estimated_count);
-        pop_data["mode"] = (pop.mode == component::Population::Mode::Simulated) ? "Simulated" : "DerivedFromIndividuals";
+        pop_data["individual_count"] = static_cast<int>(pop.individual_count);
+        switch (pop.mode) {
+            case component::Population::Mode::Simulated: pop_data["mode"] = "Simulated"; break;
+            case component::Population::Mode::DerivedFromIndividuals: pop_data["mode"] = "DerivedFromIndividuals"; break;
+            case component::Population::Mode::Converting: pop_data["mode"] = "Converting"; break;
+        }
+
+        // 基因均值：HQ/转换中的种群取存活个体的实时统计，LQ种群取种群分布
+        component::Population stats = pop;
+        if (pop.mode != component::Population::Mode::Simulated) {
+            if (const auto* moments = context->get_gene_stats().find(pop.region_id, pop.species_id)) {
+                moments->write_to(stats);
+            }
+        }
+        pop_data["avg_limb_length"] = stats.avg_limb_length;
+        pop_data["avg_body_mass"] = stats.avg_body_mass;
+        pop_data["avg_size_scale"] = stats.avg_size_scale;
 
         result.append(pop_data);
     }
@@ -218,6 +474,40 @@ TypedArray<Dictionary> SimulationWrapper::get_populations_in_region(int region_i
     return result;
 }
 
+TypedArray<Dictionary> SimulationWrapper::get_population_samples(int region_id) {
+    TypedArray<Dictionary> result;
+
+    if (!initialized) return result;
+
+    for (EntityId pop_id : registry->view<component::PopulationSamples>()) {
+        const auto& pop = registry->get_component<component::Population>(pop_id);
+        if (pop.region_id != static_cast<uint32_t>(region_id)) {
+            continue;
+        }
+
+        const auto& visual = registry->get_component<component::PopulationSamples>(pop_id);
+        for (const auto& sample : visual.samples) {
+            Dictionary dict;
+            dict["species_id"] = static_cast<int>(pop.species_id);
+            dict["region_id"] = static_cast<int>(pop.region_id);
+            dict["position"] = CoordinateMapper::to_godot_world(pop.region_id, sample.local_pos.x, sample.local_pos.z);
+            dict["weight"] = visual.weight;
+            dict["age"] = sample.lifecycle.age;
+            dict["hunger"] = sample.lifecycle.hunger;
+
+            Dictionary gene_data;
+            gene_data["limb_length"] = sample.gene.limb_length;
+            gene_data["body_mass"] = sample.gene.body_mass;
+            gene_data["size_scale"] = sample.gene.size_scale;
+            dict["gene"] = gene_data;
+
+            result.append(dict);
+        }
+    }
+
+    return result;
+}
+
 // ============================================================
 // 全局统计 API
 // ============================================================
@@ -252,6 +542,56 @@ Dictionary SimulationWrapper::get_global_statistics() {
     return stats;
 }
 
+Dictionary SimulationWrapper::get_tick_statistics() {
+    Dictionary stats;
+
+    stats["region_updates"] = static_cast<int>(region_ticks.get_updates_last_step());
+    stats["full_sweep_updates"] = static_cast<int>(region_ticks.get_full_sweep_last_step());
+    stats["min_region_updates"] = static_cast<int>(region_ticks.get_min_recent_updates());
+    stats["max_region_updates"] = static_cast<int>(region_ticks.get_max_recent_updates());
+    stats["total_region_updates"] = static_cast<int64_t>(region_ticks.get_total_updates());
+    stats["total_full_sweep_updates"] = static_cast<int64_t>(region_ticks.get_total_full_sweep());
+    stats["pending_lifecycle_events"] = initialized
+        ? static_cast<int64_t>(scheduler->get_lifecycle_events().pending_events())
+        : int64_t{0};
+    stats["effect_reduction_ratio"] = initialized
+        ? recorder->get_coalesce_stats().reduction_ratio()
+        : 0.0;
+    stats["pending_coalesced_effects"] = initialized
+        ? static_cast<int64_t>(recorder->pending_coalesced())
+        : int64_t{0};
+    stats["effects_published"] = initialized
+        ? static_cast<int64_t>(effect_bus->get_published())
+        : int64_t{0};
+    stats["pending_conversion_spawns"] = initialized
+        ? static_cast<int64_t>(conversion_system->get_pending_spawns())
+        : int64_t{0};
+    stats["pending_warming_spawns"] = initialized
+        ? static_cast<int64_t>(conversion_system->get_pending_warming_spawns())
+        : int64_t{0};
+    stats["hq_slots_allocated"] = static_cast<int64_t>(hq_budget.get_allocated());
+    stats["representative_samples"] = initialized
+        ? static_cast<int64_t>(scheduler->get_representative_sample_count())
+        : int64_t{0};
+    stats["dormant_creatures"] = initialized
+        ? static_cast<int64_t>(scheduler->get_dormant_cache().get_creature_count())
+        : int64_t{0};
+    stats["dormant_restored"] = initialized
+        ? static_cast<int64_t>(scheduler->get_dormant_cache().get_stats().restored)
+        : int64_t{0};
+    stats["food_consumed_last_step"] = initialized
+        ? scheduler->get_food_dynamics().get_last_consumption()
+        : 0.0;
+    stats["lq_migrants_last_step"] = initialized
+        ? scheduler->get_diffusion().get_last_migrants()
+        : 0.0;
+    stats["conversion_spawns_last_frame"] = initialized
+        ? static_cast<int64_t>(conversion_system->get_spawned_last_frame())
+        : int64_t{0};
+
+    return stats;
+}
+
 // ============================================================
 // 辅助函数
 // ============================================================
@@ -294,7 +634,10 @@ void SimulationWrapper::_initialize_world_populations() {
                 species.size_scale_mean,
                 species.limb_length_std,
                 species.body_mass_std,
-                species.size_scale_std
+                species.size_scale_std,
+                0.0f, 0.0f, 0.0f,  // 性状相关系数（初始独立）
+                0,                 // individual_count
+                0.0f               // count_remainder
             });
         }
     }
@@ -307,11 +650,13 @@ Dictionary SimulationWrapper::_region_to_dict(uint32_t region_id, const Region&
 
     dict["id"] = static_cast<int>(region_id);
     dict["name"] = String(region.name.c_str());
-    dict["mode"] = (region.mode == Region::Mode::LQ) ? "LQ" : "HQ";
-    dict["target_mode"] = (region.target_mode == Region::Mode::LQ) ? "LQ" : "HQ";
+    dict["mode"] = region_mode_name(region.mode);
+    dict["target_mode"] = region_mode_name(region.target_mode);
     dict["food_capacity"] = region.food_capacity;
     dict["current_food"] = region.current_food;
     dict["temperature"] = region.temperature;
+    dict["tick_period"] = static_cast<int>(region_ticks.get_period(region_id));
+    dict["hq_slots"] = static_cast<int>(hq_budget.get_region_slots(region_id));
 
     return dict;
 }
@@ -338,7 +683,7 @@ Dictionary SimulationWrapper::_creature_to_dict(EntityId entity_id) {
 
     // Lifecycle (可选)
     if (registry->has_component<component::Lifecycle>(entity_id)) {
-        const auto& lifecycle = registry->get_component<component::Lifecycle>(entity_id);
+        const auto lifecycle = scheduler->get_creature_lifecycle(entity_id);
         dict["age"] = lifecycle.age;
         dict["lifespan"] = lifecycle.lifespan;
         dict["hunger"] = lifecycle.hunger;
@@ -347,7 +692,7 @@ Dictionary SimulationWrapper::_creature_to_dict(EntityId entity_id) {
 
     // GameplayGene (可选)
     if (registry->has_component<component::GameplayGene>(entity_id)) {
-        const auto& gene = registry->get_component<component::GameplayGene>(entity_id);
+        const auto& gene = registry->get_component<component::GameplayGene>(entity_id).gene;
 
         Dictionary gene_data;
         gene_data["limb_length"] = gene.limb_length;
@@ -369,13 +714,48 @@ void SimulationWrapper::_bind_methods() {
     ClassDB::bind_method(D_METHOD("initialize"), &SimulationWrapper::initialize);
     ClassDB::bind_method(D_METHOD("update", "delta"), &SimulationWrapper::update);
     ClassDB::bind_method(D_METHOD("set_camera_position", "pos"), &SimulationWrapper::set_camera_position);
+    ClassDB::bind_method(D_METHOD("set_camera_positions", "positions"), &SimulationWrapper::set_camera_positions);
     ClassDB::bind_method(D_METHOD("get_current_time"), &SimulationWrapper::get_current_time);
     ClassDB::bind_method(D_METHOD("get_current_region", "pos"), &SimulationWrapper::get_current_region);
 
+    // 固定步长时钟
+    ClassDB::bind_method(D_METHOD("set_fixed_timestep", "dt"), &SimulationWrapper::set_fixed_timestep);
+    ClassDB::bind_method(D_METHOD("get_fixed_timestep"), &SimulationWrapper::get_fixed_timestep);
+    ClassDB::bind_method(D_METHOD("set_max_substeps", "n"), &SimulationWrapper::set_max_substeps);
+    ClassDB::bind_method(D_METHOD("get_max_substeps"), &SimulationWrapper::get_max_substeps);
+    ClassDB::bind_method(D_METHOD("get_interpolation_alpha"), &SimulationWrapper::get_interpolation_alpha);
+    ClassDB::bind_method(D_METHOD("get_steps_last_frame"), &SimulationWrapper::get_steps_last_frame);
+
+    // 个体生命周期
+    ClassDB::bind_method(D_METHOD("set_event_driven_lifecycle", "enabled"), &SimulationWrapper::set_event_driven_lifecycle);
+    ClassDB::bind_method(D_METHOD("is_event_driven_lifecycle"), &SimulationWrapper::is_event_driven_lifecycle);
+    ClassDB::bind_method(D_METHOD("set_worker_count", "workers"), &SimulationWrapper::set_worker_count);
+    ClassDB::bind_method(D_METHOD("get_worker_count"), &SimulationWrapper::get_worker_count);
+
+    // Effect合并
+    ClassDB::bind_method(D_METHOD("set_effect_coalescing", "enabled", "window_ticks", "epsilon"), &SimulationWrapper::set_effect_coalescing);
+
+    // HQ转换预算
+    ClassDB::bind_method(D_METHOD("set_conversion_budget", "max_spawns_per_frame", "max_microseconds"), &SimulationWrapper::set_conversion_budget);
+    ClassDB::bind_method(D_METHOD("set_hq_budget", "total_slots", "max_per_population"), &SimulationWrapper::set_hq_budget);
+    ClassDB::bind_method(D_METHOD("set_region_importance", "region_id", "importance"), &SimulationWrapper::set_region_importance);
+    ClassDB::bind_method(D_METHOD("set_region_visible", "region_id", "visible"), &SimulationWrapper::set_region_visible);
+    ClassDB::bind_method(D_METHOD("set_hq_prewarm", "enabled", "horizon_seconds"), &SimulationWrapper::set_hq_prewarm);
+    ClassDB::bind_method(D_METHOD("set_food_dynamics", "enabled", "regrowth_rate", "consumption_rate"), &SimulationWrapper::set_food_dynamics);
+    ClassDB::bind_method(D_METHOD("set_lq_migration", "rate", "max_outflow"), &SimulationWrapper::set_lq_migration);
+    ClassDB::bind_method(D_METHOD("set_mq_tier", "distance", "max_samples", "individuals_per_sample"), &SimulationWrapper::set_mq_tier);
+    ClassDB::bind_method(D_METHOD("set_dormant_cache", "max_kb", "max_dormant_days"), &SimulationWrapper::set_dormant_cache);
+
     // 查询方法
     ClassDB::bind_method(D_METHOD("get_all_regions"), &SimulationWrapper::get_all_regions);
     ClassDB::bind_method(D_METHOD("get_region", "region_id"), &SimulationWrapper::get_region);
+    ClassDB::bind_method(D_METHOD("get_region_hops", "from_region", "to_region"), &SimulationWrapper::get_region_hops);
+    ClassDB::bind_method(D_METHOD("get_region_path", "from_region", "to_region"), &SimulationWrapper::get_region_path);
+    ClassDB::bind_method(D_METHOD("connect_regions", "region_a", "region_b"), &SimulationWrapper::connect_regions);
+    ClassDB::bind_method(D_METHOD("disconnect_regions", "region_a", "region_b"), &SimulationWrapper::disconnect_regions);
     ClassDB::bind_method(D_METHOD("get_creatures_in_region", "region_id"), &SimulationWrapper::get_creatures_in_region);
     ClassDB::bind_method(D_METHOD("get_populations_in_region", "region_id"), &SimulationWrapper::get_populations_in_region);
+    ClassDB::bind_method(D_METHOD("get_population_samples", "region_id"), &SimulationWrapper::get_population_samples);
     ClassDB::bind_method(D_METHOD("get_global_statistics"), &SimulationWrapper::get_global_statistics);
+    ClassDB::bind_method(D_METHOD("get_tick_statistics"), &SimulationWrapper::get_tick_statistics);
 }
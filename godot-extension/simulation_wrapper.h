@@ -4,15 +4,23 @@
 #include <godot_cpp/variant/typed_array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/vector3.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 
 #include "ecs/Registry.h"
 #include "process/EffectRecorder.h"
+#include "process/EffectBus.h"
 #include "simulation/SimulationState.h"
+#include "simulation/SimulationClock.h"
 #include "process/ProcessContext.h"
 #include "process/ProcessScheduler.h"
 #include "systems/PopulationSystem.h"
 #include "systems/CreatureSystem.h"
 #include "systems/ConversionSystem.h"
+#include "systems/CameraPredictor.h"
+#include "systems/HqBudgetManager.h"
+#include "systems/RegionTickScheduler.h"
+#include "systems/RegionCreatureIndex.h"
 
 using namespace godot;
 
@@ -35,6 +43,28 @@ private:
     CreatureSystem* creature_system;
     ConversionSystem* conversion_system;
 
+    // Effect订阅总线（每步结束时分发）与由它增量维护的个体索引
+    ecs::EffectBus* effect_bus;
+    RegionCreatureIndex creature_index;
+
+    // 固定步长时钟（渲染帧率与模拟步长解耦）
+    SimulationClock clock;
+
+    // 多速率Region调度（远处LQ区域降低更新频率）
+    RegionTickScheduler region_ticks;
+
+    // 按相机速度预测即将进入的Region并提前预热
+    CameraPredictor camera_predictor;
+    bool prewarm_enabled;
+
+    // 相机距离小于该值的非HQ Region使用MQ（代表个体样本），0表示禁用
+    float mq_distance;
+
+    // 多个HQ Region共享的个体预算，按距离/可见性/重要度分配
+    HqBudgetManager hq_budget;
+    std::map<uint32_t, float> region_importance;
+    std::map<uint32_t, bool> region_visible;
+
     bool initialized;
 
 public:
@@ -47,11 +77,79 @@ public:
     void initialize();
 
     // 每帧更新 (由 Godot _process 驱动)
+    // delta累加到固定步长时钟，本帧按固定步长执行0~max_substeps步
     void update(float delta);
 
+    // ========== 固定步长时钟 ==========
+
+    void set_fixed_timestep(float dt);
+    float get_fixed_timestep() const;
+
+    void set_max_substeps(int n);
+    int get_max_substeps() const;
+
+    // 渲染插值系数 [0, 1)
+    float get_interpolation_alpha() const;
+
+    // 上一帧实际执行的模拟步数
+    int get_steps_last_frame() const;
+
+    // ========== 个体生命周期 ==========
+
+    // 事件驱动：只在死亡/阈值事件到期时处理个体，年龄和饥饿度查询时推算
+    void set_event_driven_lifecycle(bool enabled);
+    bool is_event_driven_lifecycle() const;
+
+    // 批量生命周期的工作线程数（含模拟线程，1表示单线程）；线程常驻，结果与线程数无关
+    void set_worker_count(int workers);
+    int get_worker_count() const;
+
+    // ========== Effect合并 ==========
+
+    // 同一个体同一Resource在window_ticks步内的变化合并为一条，小于epsilon的变化不输出
+    void set_effect_coalescing(bool enabled, int window_ticks, float epsilon);
+
+    // ========== 食物资源 ==========
+
+    // Region食物动态：按温度调节的恢复、所有种群的消耗；种群承载力读取实时食物
+    void set_food_dynamics(bool enabled, float regrowth_rate, float consumption_rate);
+
+    // ========== 种群迁移 ==========
+
+    // LQ种群沿Region邻接图扩散：rate为完全拥挤时每天的外迁比例（0表示禁用），
+    // max_outflow为每步最多迁出的比例
+    void set_lq_migration(float rate, float max_outflow);
+
+    // ========== HQ转换预算 ==========
+
+    // LQ→HQ每帧最多生成的个体数 / 微秒数（0表示不限制）
+    void set_conversion_budget(int max_spawns_per_frame, int max_microseconds);
+
+    // 预热：预计horizon_seconds秒内到达的Region提前在后台生成个体
+    void set_hq_prewarm(bool enabled, float horizon_seconds);
+
+    // MQ：相机距离小于distance的Region显示代表个体样本
+    // 每individuals_per_sample个个体一个样本，每个种群最多max_samples个
+    void set_mq_tier(float distance, int max_samples, int individuals_per_sample);
+
+    // 休眠个体缓存：HQ→LQ时保留个体，max_dormant_days天内返回时直接恢复（max_kb为0时禁用）
+    void set_dormant_cache(int max_kb, float max_dormant_days);
+
+    // ========== HQ预算 ==========
+
+    // 所有HQ Region的个体总数上限 / 单个种群的个体上限
+    void set_hq_budget(int total_slots, int max_per_population);
+
+    // 玩法重要度（默认1.0）与可见性（默认可见），影响HQ名额的分配顺序
+    void set_region_importance(int region_id, float importance);
+    void set_region_visible(int region_id, bool visible);
+
     // 设置相机位置 (用于HQ/LQ转换)
     void set_camera_position(Vector3 pos);
 
+    // 多个观察者（分屏/多玩家）：每个观察者所在的Region都为HQ，共享HQ预算
+    void set_camera_positions(PackedVector3Array positions);
+
     // 获取相机当前所在的Region ID
     int get_current_region(Vector3 pos);
 
@@ -66,6 +164,14 @@ public:
     // 获取单个 Region 状态
     Dictionary get_region(int region_id);
 
+    // Region间的跳数（不可达时返回-1）和最短路径（含起点终点，不可达时为空），查预计算的路由表
+    int get_region_hops(int from_region, int to_region) const;
+    PackedInt32Array get_region_path(int from_region, int to_region) const;
+
+    // 修改Region邻接关系（双向），路由表增量更新；失败（Region不存在等）返回false
+    bool connect_regions(int region_a, int region_b);
+    bool disconnect_regions(int region_a, int region_b);
+
     // ========== Creature 查询 (HQ模式区域) ==========
 
     // 获取指定 Region 的所有 Creature 数据
@@ -76,11 +182,19 @@ public:
     // 获取指定 Region 的种群统计数据
     TypedArray<Dictionary> get_populations_in_region(int region_id);
 
+    // ========== 代表个体样本 (MQ模式区域) ==========
+
+    // 获取指定 Region 的代表个体样本（weight为每个样本代表的个体数）
+    TypedArray<Dictionary> get_population_samples(int region_id);
+
     // ========== 全局统计 ==========
 
     // 获取全局种群统计 (所有Region的总和)
     Dictionary get_global_statistics();
 
+    // 多速率调度统计：本步/累计的Region更新次数与全量更新次数
+    Dictionary get_tick_statistics();
+
 protected:
     // Godot绑定注册
     static void _bind_methods();
@@ -89,6 +203,12 @@ private:
     // 辅助函数：初始化世界种群
     void _initialize_world_populations();
 
+    // 辅助函数：执行一个固定步长的模拟步
+    void _step(float dt);
+
+    // 辅助函数：按观察者位置设置各Region的target_mode并提交HQ预算请求
+    void _update_viewers(const std::vector<Vector3>& viewers);
+
     // 辅助函数：将Region转换为Dictionary
     Dictionary _region_to_dict(uint32_t region_id, const Region& region);
 
@@ -0,0 +1,70 @@
+extends Node3D
+
+## SampleRenderer - MQ区域代表个体渲染器
+## 每个(Region, 物种)一个MultiMeshInstance3D，一次绘制调用渲染该组所有样本
+
+const SPECIES_STYLE = {
+	1: {"color": Color(0.9, 0.85, 0.75), "size": Vector3(0.5, 0.5, 0.8)},  # Rabbit
+	2: {"color": Color(0.45, 0.45, 0.5), "size": Vector3(0.7, 0.9, 1.4)},   # Wolf
+	3: {"color": Color(0.35, 0.25, 0.15), "size": Vector3(1.2, 1.4, 2.0)}   # Bear
+}
+
+# {region_id: {species_id: MultiMeshInstance3D}}
+var region_groups: Dictionary = {}
+
+func update_region(region_id: int, samples: Array):
+	# 按物种分组
+	var by_species = {}
+	for sample in samples:
+		var species_id = sample.species_id
+		if not by_species.has(species_id):
+			by_species[species_id] = []
+		by_species[species_id].append(sample)
+
+	if not region_groups.has(region_id):
+		region_groups[region_id] = {}
+	var groups = region_groups[region_id]
+
+	for species_id in SPECIES_STYLE.keys():
+		var species_samples = by_species.get(species_id, [])
+		if species_samples.is_empty():
+			if groups.has(species_id):
+				groups[species_id].multimesh.instance_count = 0
+			continue
+
+		if not groups.has(species_id):
+			groups[species_id] = _create_group(species_id)
+
+		var multimesh: MultiMesh = groups[species_id].multimesh
+		multimesh.instance_count = species_samples.size()
+		for i in range(species_samples.size()):
+			var sample = species_samples[i]
+			var scale_factor = sample.gene.get("size_scale", 1.0)
+			var basis = Basis().scaled(Vector3.ONE * scale_factor)
+			multimesh.set_instance_transform(i, Transform3D(basis, sample.position))
+
+func clear_region(region_id: int):
+	if not region_groups.has(region_id):
+		return
+
+	for species_id in region_groups[region_id].keys():
+		region_groups[region_id][species_id].multimesh.instance_count = 0
+
+func _create_group(species_id: int) -> MultiMeshInstance3D:
+	var style = SPECIES_STYLE[species_id]
+
+	var mesh = BoxMesh.new()
+	mesh.size = style.size
+
+	var material = StandardMaterial3D.new()
+	material.albedo_color = style.color
+	mesh.material = material
+
+	var multimesh = MultiMesh.new()
+	multimesh.transform_format = MultiMesh.TRANSFORM_3D
+	multimesh.mesh = mesh
+
+	var instance = MultiMeshInstance3D.new()
+	instance.multimesh = multimesh
+	add_child(instance)
+	return instance
@@ -6,6 +6,7 @@ extends Node
 var simulation = null  # SimulationWrapper实例
 
 @onready var creature_manager = get_node_or_null("../CreatureManager")
+@onready var sample_renderer = get_node_or_null("../SampleRenderer")
 @onready var player_camera = get_node_or_null("../PlayerCamera")
 
 func _ready():
@@ -55,5 +56,12 @@ func _sync_creatures():
 			var creatures = simulation.get_creatures_in_region(region_id)
 			creature_manager.update_creatures(region_id, creatures)
 		else:
-			# LQ模式：清空该区域的个体
+			# LQ/MQ/预热模式：不显示该区域的个体
 			creature_manager.clear_region(region_id)
+
+		if sample_renderer:
+			if mode == "MQ":
+				# MQ模式：实例化渲染代表个体样本
+				sample_renderer.update_region(region_id, simulation.get_population_samples(region_id))
+			else:
+				sample_renderer.clear_region(region_id)
@@ -1,6 +1,8 @@
 #include <iostream>
+#include <fstream>
 #include <filesystem>
 #include <vector>
+#include <string>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -8,6 +10,7 @@
 
 #include "ecs/Registry.h"
 #include "process/EffectRecorder.h"
+#include "process/EffectJournal.h"
 #include "process/ProcessContext.h"
 #include "process/ProcessScheduler.h"
 #include "simulation/SimulationState.h"
@@ -15,7 +18,12 @@
 #include "systems/CreatureSystem.h"
 #include "systems/ConversionSystem.h"
 #include "export/DataExporter.h"
+#include "export/WorldSnapshot.h"
 #include "components/Components.h"
+#include "tools/PopulationBenchmark.h"
+#include "tools/ProcessRuntimeBenchmark.h"
+#include "tools/ParallelLifecycleValidation.h"
+#include "tools/ReplayTool.h"
 
 // ============================================================
 // GameWorld ERPE生态模拟主程序
@@ -62,7 +70,10 @@ void initialize_populations(ecs::Registry& registry, SimulationState& state) {
                 species.size_scale_mean,
                 species.limb_length_std,
                 species.body_mass_std,
-                species.size_scale_std
+                species.size_scale_std,
+                0.0f, 0.0f, 0.0f,  // 性状相关系数（初始独立）
+                0,                 // individual_count
+                0.0f               // count_remainder
             });
 
             std::cout << "  Created Population: " << species.name
@@ -74,12 +85,59 @@ void initialize_populations(ecs::Registry& registry, SimulationState& state) {
     std::cout << "World initialization complete!\n" << std::endl;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
 #ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
     SetConsoleCP(CP_UTF8);
 #endif
 
+    // ========== 工具模式 ==========
+    if (argc > 1) {
+        std::string command = argv[1];
+
+        if (command == "--validate-fast-forward") {
+            return PopulationBenchmark::ValidateFastForward(std::cout) ? 0 : 1;
+        }
+        if (command == "--bench-integrators") {
+            return PopulationBenchmark::CompareIntegrators(std::cout) ? 0 : 1;
+        }
+        if (command == "--validate-parallel-lifecycle") {
+            uint32_t workers = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 4;
+            return ParallelLifecycleValidation::Run(std::cout, workers) ? 0 : 1;
+        }
+        if (command == "--bench-process-runtime") {
+            return ProcessRuntimeBenchmark::Run(std::cout) ? 0 : 1;
+        }
+        if (command == "--decode-journal" && argc > 2) {
+            // 解码为文本：写到指定文件，未指定时写到标准输出
+            std::ofstream file;
+            if (argc > 3) {
+                file.open(argv[3]);
+                if (!file) {
+                    std::cerr << "Cannot open output: " << argv[3] << std::endl;
+                    return 1;
+                }
+            }
+            std::ostream& out = argc > 3 ? static_cast<std::ostream&>(file) : std::cout;
+
+            auto result = ecs::decode_journal_to_text(argv[2], out);
+            if (result.is_err()) {
+                std::cerr << "Failed to decode journal: "
+                          << core::error_code_to_string(result.error()) << std::endl;
+                return 1;
+            }
+            std::cerr << "Decoded " << result.value() << " effects" << std::endl;
+            return 0;
+        }
+        if (command == "--replay" && argc > 4) {
+            return ReplayTool::Seek(argv[2], argv[3], std::stoull(argv[4]), std::cout) ? 0 : 1;
+        }
+
+        std::cerr << "Unknown option: " << command << std::endl;
+        std::cerr << "Usage: GameWorld [--validate-fast-forward | --validate-parallel-lifecycle [workers] | --bench-integrators | --bench-process-runtime | --decode-journal <journal> [out.txt] | --replay <journal> <snapshots> <tick>]" << std::endl;
+        return 1;
+    }
+
     std::cout << "╔═══════════════════════════════════════════════════╗\n";
     std::cout << "║  GameWorld - ERPE Ecosystem Simulation           ║\n";
     std::cout << "║  ERPE生态模拟系统 - 种群涌现与HQ/LQ切换演示       ║\n";
@@ -99,6 +157,10 @@ int main() {
     // ========== 2. 创建数据导出器 ==========
     std::cout << "[2/7] Creating data exporter..." << std::endl;
     DataExporter exporter("output/simulation_data.csv");
+    ecs::EffectJournalWriter journal;
+    journal.open("output/effects.journal");
+    WorldSnapshotWriter snapshots;
+    snapshots.open("output/world.snapshots");
 
     // ========== 3. 创建Process和System ==========
     std::cout << "[3/7] Creating process scheduler and systems..." << std::endl;
@@ -119,6 +181,7 @@ int main() {
     const float dt = 1.0f;              // 每步1天
     const float total_time = 500.0f;    // 总共500天
     const uint32_t log_interval = 10;   // 每10步输出一次
+    const uint32_t keyframe_interval = 50;  // 每50步一个回放关键帧
 
     for (uint32_t step = 0; state.current_time < total_time; ++step) {
         recorder.clear();
@@ -127,14 +190,26 @@ int main() {
         conversion_system.update_region_modes();
 
         // 更新种群（LQ区域）
+        pop_system.update_food(dt);
         pop_system.update(dt);
+        pop_system.update_migration(dt);
 
         // 更新个体（HQ区域）
         creature_system.update(dt);
 
+        // 长期运行的Process（Buff/工单等协程）
+        scheduler.execute_long_running_processes(dt);
+
+        // 输出窗口已满的合并Effect，本步的Effect写入日志（后台线程落盘）
+        recorder.end_tick();
+        journal.append_tick(step, state.current_time, state.lifecycle_clock, recorder);
+        if (step % keyframe_interval == 0 || WorldSnapshotWriter::needs_keyframe(recorder)) {
+            snapshots.write_keyframe(step, registry, state);
+        }
+
         // 记录数据（每log_interval步）
         if (step % log_interval == 0) {
-            exporter.write_timestep(state.current_time, registry, state);
+            exporter.write_timestep(state.current_time, registry, state, ctx.get_gene_stats());
 
             // 简单控制台输出
             if (step % (log_interval * 5) == 0) {  // 每50步输出摘要
@@ -165,8 +240,15 @@ int main() {
     std::cout << "[6/7] Simulation complete!" << std::endl;
 
     exporter.finalize();
+    journal.close();
+    snapshots.close();
 
     std::cout << "\n✅ Data exported to: output/simulation_data.csv" << std::endl;
+    std::cout << "✅ Effect journal: output/effects.journal ("
+              << journal.get_frames_written() << " ticks, "
+              << journal.get_bytes_written() << " bytes)" << std::endl;
+    std::cout << "✅ Replay keyframes: output/world.snapshots ("
+              << snapshots.get_keyframes_written() << " keyframes)" << std::endl;
     std::cout << "\n📊 To visualize results, run:" << std::endl;
 #ifdef _WIN32
     std::cout << "   python\\python.exe python\\visualize.py output\\simulation_data.csv" << std::endl;
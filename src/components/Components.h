@@ -4,6 +4,7 @@
 #include "gene/AppearanceGene.h"
 #include "core/Types.h"
 #include "geometry/MeshData.h"
+#include <vector>
 
 // ============================================================
 // ECS组件定义
@@ -41,7 +42,8 @@ struct Population {
 
     enum class Mode {
         Simulated,              // 种群级模拟（LQ区）
-        DerivedFromIndividuals  // 从个体统计（HQ区）
+        DerivedFromIndividuals, // 从个体统计（HQ区）
+        Converting              // LQ→HQ分帧生成个体中（种群级模拟暂停）
     };
     Mode mode;
 
@@ -54,6 +56,19 @@ struct Population {
     float std_limb_length;
     float std_body_mass;
     float std_size_scale;
+
+    // 性状间的相关系数（与标准差一起构成采样用的协方差）
+    float corr_limb_mass;
+    float corr_limb_scale;
+    float corr_mass_scale;
+
+    // 已生成为HQ个体的数量（LQ余量 = estimated_count - individual_count）
+    uint32_t  individual_count;
+
+    // 批量积分写回时舍入掉的零头（连续状态 = estimated_count + count_remainder），
+    // 下一步积分从连续状态继续，避免每步小于0.5的变化被舍入丢失；
+    // 数量统一经dynamics::store_count写入，其他来源的写入把零头清零
+    float     count_remainder;
 };
 
 // 位置组件（用于Creature和Population）
@@ -70,9 +85,30 @@ struct Lifecycle {
     float health;        // 健康度 0.0-1.0（<0.05死亡）
 };
 
+// 生命周期调度组件（事件驱动模式下使用）
+// Lifecycle中的数值对应 anchor_time 时刻，当前值按线性规律惰性推算
+struct LifecycleSchedule {
+    double   anchor_time;    // Lifecycle数值的基准时刻（生命周期时钟）
+    uint32_t generation;     // 重新调度时递增，用于识别过期事件
+};
+
 // 物种引用组件（用于Creature）
 struct SpeciesRef {
     SpeciesId species_id;
 };
 
+// 代表个体样本（MQ区，用于Population实体）
+// 每个样本代表weight个个体；种群统计仍是权威数据，样本只反映其分布，不产生Effect
+struct RepresentativeSample {
+    ::GameplayGene gene;
+    Lifecycle lifecycle;
+    Vec3 local_pos;
+};
+
+struct PopulationSamples {
+    std::vector<RepresentativeSample> samples;
+    float weight;           // 每个样本代表的个体数
+    uint32_t next_serial;   // 下一个样本的随机流编号
+};
+
 } // namespace component
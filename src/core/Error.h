@@ -29,6 +29,10 @@ enum class ErrorCode : uint8_t {
     SPECIES_NOT_FOUND = 31,
     INVALID_REGION_ID = 32,
     INVALID_SPECIES_ID = 33,
+
+    // IO错误 (40-49)
+    IO_ERROR = 40,
+    CORRUPT_DATA = 41,
 };
 
 // 错误信息辅助函数 (仅用于调试输出)
@@ -48,6 +52,8 @@ inline const char* error_code_to_string(ErrorCode code) {
         case ErrorCode::SPECIES_NOT_FOUND: return "SPECIES_NOT_FOUND";
         case ErrorCode::INVALID_REGION_ID: return "INVALID_REGION_ID";
         case ErrorCode::INVALID_SPECIES_ID: return "INVALID_SPECIES_ID";
+        case ErrorCode::IO_ERROR: return "IO_ERROR";
+        case ErrorCode::CORRUPT_DATA: return "CORRUPT_DATA";
         default: return "UNKNOWN";
     }
 }
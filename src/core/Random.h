@@ -0,0 +1,331 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Box-Muller只用SSE2（x86-64的基线指令集）：AVX构建与SSE2构建的结果逐位一致
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GW_RANDOM_SSE2 1
+#endif
+
+// ============================================================
+// 基于计数器的确定性随机数（Philox4x32-10）
+// 随机流由 (world_seed, entity_id, stream) 唯一确定，
+// 第 i 个输出只取决于这三个值和 i，与调用顺序、线程数无关；
+// 状态只有几十字节，可随时按需构造
+// ============================================================
+
+namespace core {
+
+// 随机流用途（同一实体的不同用途互不相关）
+enum class RngStream : uint32_t {
+    Gene = 1,        // 个体基因采样
+    Lifecycle = 2,   // 初始年龄等生命周期参数
+    Appearance = 3,  // 纯视觉随机字段
+    Sample = 4,      // MQ代表个体样本
+};
+
+// Philox4x32-10 分组函数：counter(128位) + key(64位) → 128位随机输出
+inline void philox4x32_10(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]) {
+    constexpr uint32_t kMul0 = 0xD2511F53u;
+    constexpr uint32_t kMul1 = 0xCD9E8D57u;
+    constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+    constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for (int round = 0; round < 10; ++round) {
+        uint64_t p0 = static_cast<uint64_t>(kMul0) * c0;
+        uint64_t p1 = static_cast<uint64_t>(kMul1) * c2;
+
+        uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+        uint32_t n1 = static_cast<uint32_t>(p1);
+        uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+        uint32_t n3 = static_cast<uint32_t>(p0);
+
+        c0 = n0; c1 = n1; c2 = n2; c3 = n3;
+        k0 += kWeyl0;
+        k1 += kWeyl1;
+    }
+
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+// 32位整数 → [0, 1) 浮点（取高24位，精确可表示）
+inline float u32_to_unit_float(uint32_t x) {
+    return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+}
+
+// ============================================================
+// Box-Muller变换内核
+// log与sincos用Cephes多项式实现（标准库的logf/sinf/cosf无法向量化），
+// SSE2路径与标量回退路径执行完全相同的运算序列
+//   log(u)：拆出指数e与尾数m∈[√½, √2)，ln(u) = ln(m) + e·ln2，ln(m)用9阶多项式
+//   sincos(2πu)：u∈[0,1)按八分之一周期取整j（精确），x = 2π(u - j/8) ∈ [-π/4, π/4]，
+//               按j选择sin/cos多项式与符号
+// 相对误差约1e-7，与float精度相当
+// ============================================================
+
+namespace detail {
+
+constexpr float kTwoPi = 6.28318530717958647692f;
+constexpr float kSqrtHalf = 0.707106781186547524f;
+
+constexpr float kLogP0 = 7.0376836292E-2f;
+constexpr float kLogP1 = -1.1514610310E-1f;
+constexpr float kLogP2 = 1.1676998740E-1f;
+constexpr float kLogP3 = -1.2420140846E-1f;
+constexpr float kLogP4 = 1.4249322787E-1f;
+constexpr float kLogP5 = -1.6668057665E-1f;
+constexpr float kLogP6 = 2.0000714765E-1f;
+constexpr float kLogP7 = -2.4999993993E-1f;
+constexpr float kLogP8 = 3.3333331174E-1f;
+constexpr float kLogQ1 = -2.12194440e-4f;
+constexpr float kLogQ2 = 0.693359375f;
+
+constexpr float kSinP0 = -1.9515295891E-4f;
+constexpr float kSinP1 = 8.3321608736E-3f;
+constexpr float kSinP2 = -1.6666654611E-1f;
+constexpr float kCosP0 = 2.443315711809948E-5f;
+constexpr float kCosP1 = -1.388731625493765E-3f;
+constexpr float kCosP2 = 4.166664568298827E-2f;
+
+// 标量版本：u1 ∈ (0, 1]（正规数），u2 ∈ [0, 1)；返回 r = sqrt(-2 ln u1) 与 sincos(2π u2)
+inline void box_muller_scalar(float u1, float u2, float& z_cos, float& z_sin) {
+    // ln(u1)
+    uint32_t bits;
+    std::memcpy(&bits, &u1, sizeof(bits));
+    float e = static_cast<float>(static_cast<int32_t>(bits >> 23) - 126);
+    bits = (bits & 0x007FFFFFu) | 0x3F000000u;
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));  // m ∈ [0.5, 1)
+
+    bool small = m < kSqrtHalf;
+    float tmp = small ? m : 0.0f;
+    e = e - (small ? 1.0f : 0.0f);
+    m = (m - 1.0f) + tmp;
+
+    float z = m * m;
+    float y = kLogP0;
+    y = y * m + kLogP1;
+    y = y * m + kLogP2;
+    y = y * m + kLogP3;
+    y = y * m + kLogP4;
+    y = y * m + kLogP5;
+    y = y * m + kLogP6;
+    y = y * m + kLogP7;
+    y = y * m + kLogP8;
+    y = y * m;
+    y = y * z;
+    y = y + e * kLogQ1;
+    y = y - z * 0.5f;
+    float log_u1 = (m + y) + e * kLogQ2;
+
+    float r = std::sqrt(-2.0f * log_u1);
+
+    // sincos(2π u2)
+    int32_t j = static_cast<int32_t>(u2 * 8.0f);
+    j = (j + 1) & ~1;
+    float x = (u2 - static_cast<float>(j) * 0.125f) * kTwoPi;
+    float x2 = x * x;
+
+    float s = kSinP0;
+    s = s * x2 + kSinP1;
+    s = s * x2 + kSinP2;
+    s = s * x2;
+    s = s * x;
+    s = s + x;
+
+    float c = kCosP0;
+    c = c * x2 + kCosP1;
+    c = c * x2 + kCosP2;
+    c = c * x2;
+    c = c * x2;
+    c = c - x2 * 0.5f;
+    c = c + 1.0f;
+
+    bool swap = (j & 2) != 0;
+    float sin_v = swap ? c : s;
+    float cos_v = swap ? s : c;
+    if (j & 4) sin_v = -sin_v;
+    if ((j + 2) & 4) cos_v = -cos_v;
+
+    z_cos = r * cos_v;
+    z_sin = r * sin_v;
+}
+
+#if defined(GW_RANDOM_SSE2)
+
+// SSE2：一次处理4对均匀数，z按 {r·cos, r·sin} 交错写出8个
+inline void box_muller_sse2(const float* u1, const float* u2, float* z) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    // ln(u1)
+    __m128 x = _mm_loadu_ps(u1);
+    __m128i bits = _mm_castps_si128(x);
+    __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)),
+                                             _mm_set1_epi32(0x3F000000)));
+
+    __m128 small = _mm_cmplt_ps(m, _mm_set1_ps(kSqrtHalf));
+    __m128 tmp = _mm_and_ps(small, m);
+    e = _mm_sub_ps(e, _mm_and_ps(small, one));
+    m = _mm_add_ps(_mm_sub_ps(m, one), tmp);
+
+    __m128 z2 = _mm_mul_ps(m, m);
+    __m128 y = _mm_set1_ps(kLogP0);
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP1));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP2));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP3));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP4));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP5));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP6));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP7));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(kLogP8));
+    y = _mm_mul_ps(y, m);
+    y = _mm_mul_ps(y, z2);
+    y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(kLogQ1)));
+    y = _mm_sub_ps(y, _mm_mul_ps(z2, half));
+    __m128 log_u1 = _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(kLogQ2)));
+
+    __m128 r = _mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), log_u1));
+
+    // sincos(2π u2)
+    __m128 u = _mm_loadu_ps(u2);
+    __m128i j = _mm_cvttps_epi32(_mm_mul_ps(u, _mm_set1_ps(8.0f)));
+    j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    __m128 xr = _mm_mul_ps(_mm_sub_ps(u, _mm_mul_ps(_mm_cvtepi32_ps(j), _mm_set1_ps(0.125f))),
+                           _mm_set1_ps(kTwoPi));
+    __m128 x2 = _mm_mul_ps(xr, xr);
+
+    __m128 s = _mm_set1_ps(kSinP0);
+    s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(kSinP1));
+    s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(kSinP2));
+    s = _mm_mul_ps(s, x2);
+    s = _mm_mul_ps(s, xr);
+    s = _mm_add_ps(s, xr);
+
+    __m128 c = _mm_set1_ps(kCosP0);
+    c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(kCosP1));
+    c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(kCosP2));
+    c = _mm_mul_ps(c, x2);
+    c = _mm_mul_ps(c, x2);
+    c = _mm_sub_ps(c, _mm_mul_ps(x2, half));
+    c = _mm_add_ps(c, one);
+
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128i four = _mm_set1_epi32(4);
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, two), two));
+    __m128 sin_v = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+    __m128 cos_v = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+    sin_v = _mm_xor_ps(sin_v, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, four), 29)));
+    cos_v = _mm_xor_ps(cos_v, _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(j, two), four), 29)));
+
+    __m128 zc = _mm_mul_ps(r, cos_v);
+    __m128 zs = _mm_mul_ps(r, sin_v);
+    _mm_storeu_ps(z, _mm_unpacklo_ps(zc, zs));
+    _mm_storeu_ps(z + 4, _mm_unpackhi_ps(zc, zs));
+}
+
+#endif
+
+} // namespace detail
+
+class CounterRng {
+public:
+    CounterRng(uint64_t world_seed, uint64_t entity_id, RngStream stream)
+        : index_(0), buffered_(0) {
+        key_[0] = static_cast<uint32_t>(world_seed);
+        key_[1] = static_cast<uint32_t>(world_seed >> 32);
+        entity_lo_ = static_cast<uint32_t>(entity_id);
+        entity_hi_ = static_cast<uint32_t>(entity_id >> 32);
+        stream_ = static_cast<uint32_t>(stream);
+    }
+
+    uint32_t next_u32() {
+        if (buffered_ == 0) {
+            refill();
+        }
+        return block_[4 - buffered_--];
+    }
+
+    // [0, 1)
+    float next_float() {
+        return u32_to_unit_float(next_u32());
+    }
+
+    float uniform(float lo, float hi) {
+        return lo + (hi - lo) * next_float();
+    }
+
+    // 批量生成标准正态分布（Box-Muller），out[i] = mean + stddev * z_i
+    // 先批量取均匀数，再用SSE2内核每次变换4对（无SSE2时走相同运算的标量路径）
+    void fill_normal(float* out, size_t n, float mean = 0.0f, float stddev = 1.0f) {
+        constexpr size_t kChunk = 16;  // 每批生成的正态数（偶数，SSE2每次8个）
+
+        float u1[kChunk / 2];
+        float u2[kChunk / 2];
+
+        for (size_t base = 0; base < n; base += kChunk) {
+            for (size_t i = 0; i < kChunk / 2; ++i) {
+                // u1 ∈ (0, 1]，避免 log(0)
+                u1[i] = 1.0f - next_float();
+                u2[i] = next_float();
+            }
+
+            float z[kChunk];
+#if defined(GW_RANDOM_SSE2)
+            for (size_t i = 0; i < kChunk / 2; i += 4) {
+                detail::box_muller_sse2(u1 + i, u2 + i, z + 2 * i);
+            }
+#else
+            for (size_t i = 0; i < kChunk / 2; ++i) {
+                detail::box_muller_scalar(u1[i], u2[i], z[2 * i], z[2 * i + 1]);
+            }
+#endif
+
+            size_t count = (n - base < kChunk) ? (n - base) : kChunk;
+            for (size_t i = 0; i < count; ++i) {
+                out[base + i] = mean + stddev * z[i];
+            }
+        }
+    }
+
+    float normal(float mean, float stddev) {
+        // 单个正态数：消耗两个均匀数，丢弃配对的另一个值
+        float u1 = 1.0f - next_float();
+        float u2 = next_float();
+        float z_cos, z_sin;
+        detail::box_muller_scalar(u1, u2, z_cos, z_sin);
+        return mean + stddev * z_cos;
+    }
+
+private:
+    void refill() {
+        uint32_t counter[4] = {
+            static_cast<uint32_t>(index_),
+            stream_ ^ static_cast<uint32_t>(index_ >> 32),
+            entity_lo_,
+            entity_hi_
+        };
+        philox4x32_10(counter, key_, block_);
+        ++index_;
+        buffered_ = 4;
+    }
+
+    uint32_t key_[2];
+    uint32_t entity_lo_;
+    uint32_t entity_hi_;
+    uint32_t stream_;
+    uint64_t index_;       // 分组序号
+    uint32_t block_[4];    // 当前分组的输出
+    uint32_t buffered_;    // block_中剩余未用的个数
+};
+
+} // namespace core
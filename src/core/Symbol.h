@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// ============================================================
+// 符号表：把资源名/死亡原因/组件名等短字符串驻留为32位ID
+// Effect中只保存Symbol，文本只在输出日志时解析。
+// 常用符号在表构造时按固定顺序注册（ID为编译期常量，见 core::sym），
+// 其他名字运行时通过 intern() 注册（调用方应缓存结果）。
+// ============================================================
+
+namespace core {
+
+struct Symbol {
+    uint32_t id = 0;
+
+    friend bool operator==(Symbol a, Symbol b) { return a.id == b.id; }
+    friend bool operator!=(Symbol a, Symbol b) { return a.id != b.id; }
+};
+
+// 内置符号（顺序必须与 SymbolTable::kBuiltinNames 一致）
+namespace sym {
+    inline constexpr Symbol None{0};
+    // Resource
+    inline constexpr Symbol Age{1};
+    inline constexpr Symbol Hunger{2};
+    inline constexpr Symbol Health{3};
+    inline constexpr Symbol EstimatedCount{4};
+    // 死亡原因
+    inline constexpr Symbol Starvation{5};
+    inline constexpr Symbol Illness{6};
+    inline constexpr Symbol OldAge{7};
+    inline constexpr Symbol Predation{8};
+    inline constexpr Symbol PopulationExtinction{9};
+    inline constexpr Symbol Unknown{10};
+    // 销毁原因
+    inline constexpr Symbol HqToLqConversion{11};
+    // 组件
+    inline constexpr Symbol GameplayGene{12};
+    inline constexpr Symbol SpeciesRef{13};
+    inline constexpr Symbol Position{14};
+    inline constexpr Symbol Lifecycle{15};
+    inline constexpr Symbol Population{16};
+    inline constexpr Symbol Appearance{17};
+    // 创建原因
+    inline constexpr Symbol DormantRestore{18};
+    // 销毁原因（HQ预算缩减）
+    inline constexpr Symbol HqBudgetShrink{19};
+    // Region/世界状态字段
+    inline constexpr Symbol RegionMode{20};
+    inline constexpr Symbol CurrentFood{21};
+    inline constexpr Symbol LifecycleMode{22};
+}
+
+class SymbolTable {
+public:
+    static SymbolTable& global() {
+        static SymbolTable table;
+        return table;
+    }
+
+    // 注册名字（已存在则返回原ID）
+    Symbol intern(std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return intern_locked(name);
+    }
+
+    // 查找已注册的名字，不存在返回 sym::None
+    Symbol find(std::string_view name) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = ids_.find(name);
+        return it != ids_.end() ? Symbol{it->second} : sym::None;
+    }
+
+    // ID → 名字（未知ID返回"?"）
+    std::string_view name(Symbol symbol) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (symbol.id >= names_.size()) {
+            return "?";
+        }
+        return names_[symbol.id];
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return names_.size();
+    }
+
+private:
+    static constexpr const char* kBuiltinNames[] = {
+        "",
+        "age", "hunger", "health", "estimated_count",
+        "starvation", "illness", "old_age", "predation", "population_extinction", "unknown",
+        "hq_to_lq_conversion",
+        "GameplayGene", "SpeciesRef", "Position", "Lifecycle", "Population", "Appearance",
+        "dormant_restore",
+        "hq_budget_shrink",
+        "region_mode", "current_food", "lifecycle_mode",
+    };
+    static_assert(sizeof(kBuiltinNames) / sizeof(kBuiltinNames[0]) == sym::LifecycleMode.id + 1,
+                  "Builtin symbol list out of sync with core::sym");
+
+    SymbolTable() {
+        for (const char* builtin : kBuiltinNames) {
+            intern_locked(builtin);
+        }
+    }
+
+    Symbol intern_locked(std::string_view name) {
+        auto it = ids_.find(name);
+        if (it != ids_.end()) {
+            return Symbol{it->second};
+        }
+
+        uint32_t id = static_cast<uint32_t>(names_.size());
+        // deque保证已有元素地址不变，键可以直接引用存储的字符串
+        const std::string& stored = names_.emplace_back(name);
+        ids_.emplace(std::string_view(stored), id);
+        return Symbol{id};
+    }
+
+    mutable std::mutex mutex_;
+    std::deque<std::string> names_;
+    std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+inline Symbol intern(std::string_view name) {
+    return SymbolTable::global().intern(name);
+}
+
+inline std::string_view symbol_name(Symbol symbol) {
+    return SymbolTable::global().name(symbol);
+}
+
+} // namespace core
@@ -8,6 +8,13 @@ EntityId Registry::create_entity(EntityType type) {
     return id;
 }
 
+void Registry::create_entity_with_id(EntityId id, EntityType type) {
+    entity_types_[id] = type;
+    if (id >= next_entity_id_) {
+        next_entity_id_ = id + 1;
+    }
+}
+
 void Registry::destroy_entity(EntityId id) {
     // 从所有组件存储中移除
     for (auto& [type_idx, storage] : component_storages_) {
@@ -18,6 +25,12 @@ void Registry::destroy_entity(EntityId id) {
     entity_types_.erase(id);
 }
 
+void Registry::clear() {
+    entity_types_.clear();
+    component_storages_.clear();
+    next_entity_id_ = 1;
+}
+
 bool Registry::entity_exists(EntityId id) const {
     return entity_types_.find(id) != entity_types_.end();
 }
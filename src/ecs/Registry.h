@@ -23,6 +23,9 @@ public:
     // 创建实体
     EntityId create_entity(EntityType type);
 
+    // 以指定ID创建实体（快照恢复/回放用，后续create_entity不会复用该ID）
+    void create_entity_with_id(EntityId id, EntityType type);
+
     // 销毁实体（及其所有组件）
     void destroy_entity(EntityId id);
 
@@ -100,6 +103,25 @@ public:
         }
     }
 
+    // 获取组件存储（用于批量遍历紧凑组件池，不存在则返回nullptr）
+    template<typename Component>
+    ComponentStorage<Component>* get_storage() {
+        auto it = component_storages_.find(std::type_index(typeid(Component)));
+        if (it == component_storages_.end()) {
+            return nullptr;
+        }
+        return static_cast<ComponentStorage<Component>*>(it->second.get());
+    }
+
+    template<typename Component>
+    const ComponentStorage<Component>* get_storage() const {
+        auto it = component_storages_.find(std::type_index(typeid(Component)));
+        if (it == component_storages_.end()) {
+            return nullptr;
+        }
+        return static_cast<const ComponentStorage<Component>*>(it->second.get());
+    }
+
     // 获取所有拥有指定组件的实体（用于单组件查询）
     template<typename Component>
     const std::vector<EntityId>& view() const {
@@ -138,6 +160,13 @@ public:
         return entity_types_;
     }
 
+    // 下一个分配的实体ID（快照保存/恢复用）
+    EntityId get_next_entity_id() const { return next_entity_id_; }
+    void set_next_entity_id(EntityId id) { next_entity_id_ = id; }
+
+    // 清空所有实体和组件
+    void clear();
+
 private:
     EntityId next_entity_id_;
     std::unordered_map<EntityId, EntityType> entity_types_;
@@ -25,7 +25,8 @@ void DataExporter::write_header() {
           << "food_available,creature_count\n";
 }
 
-void DataExporter::write_timestep(float time, const ecs::Registry& registry, const SimulationState& state) {
+void DataExporter::write_timestep(float time, const ecs::Registry& registry, const SimulationState& state,
+                                  const process::GeneStatistics& gene_stats) {
     if (!is_open_) return;
 
     // 遍历所有Population实体
@@ -33,21 +34,21 @@ void DataExporter::write_timestep(float time, const ecs::Registry& registry, con
 
     for (EntityId pop_id : all_pops) {
         const auto& pop = registry.get_component<component::Population>(pop_id);
-        const auto& region = state.get_region(pop.region_id);
-        const auto& species = state.get_species_template(pop.species_id);
+        auto region_result = state.get_region(pop.region_id);
+        auto species_result = state.get_species_template(pop.species_id);
+        if (region_result.is_err() || species_result.is_err()) {
+            continue;
+        }
+        const auto& region = region_result.value().get();
+        const auto& species = species_result.value().get();
 
-        // 统计该Region该物种的Creature数量
+        // HQ或转换中的种群报告存活个体的数量和实时基因均值
         uint32_t creature_count = 0;
-        if (pop.mode == component::Population::Mode::DerivedFromIndividuals) {
-            const auto& all_creatures = registry.view<component::SpeciesRef>();
-            for (EntityId cid : all_creatures) {
-                if (registry.has_component<component::Position>(cid)) {
-                    const auto& species_ref = registry.get_component<component::SpeciesRef>(cid);
-                    const auto& pos = registry.get_component<component::Position>(cid);
-                    if (pos.region_id == pop.region_id && species_ref.species_id == pop.species_id) {
-                        creature_count++;
-                    }
-                }
+        component::Population stats = pop;
+        if (pop.mode != component::Population::Mode::Simulated) {
+            if (const auto* moments = gene_stats.find(pop.region_id, pop.species_id)) {
+                creature_count = moments->count();
+                moments->write_to(stats);
             }
         }
 
@@ -59,9 +60,9 @@ void DataExporter::write_timestep(float time, const ecs::Registry& registry, con
               << species.name << ","
               << (pop.mode == component::Population::Mode::Simulated ? "LQ" : "HQ") << ","
               << pop.estimated_count << ","
-              << pop.avg_limb_length << ","
-              << pop.avg_body_mass << ","
-              << pop.avg_size_scale << ","
+              << stats.avg_limb_length << ","
+              << stats.avg_body_mass << ","
+              << stats.avg_size_scale << ","
               << region.current_food << ","
               << creature_count << "\n";
     }
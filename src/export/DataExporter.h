@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ecs/Registry.h"
+#include "process/GeneStatistics.h"
 #include "simulation/SimulationState.h"
 #include <string>
 #include <fstream>
@@ -14,8 +15,9 @@ public:
     DataExporter(const std::string& filepath);
     ~DataExporter();
 
-    // 写入一个时间步的数据
-    void write_timestep(float time, const ecs::Registry& registry, const SimulationState& state);
+    // 写入一个时间步的数据（HQ种群的个体数量和基因均值取自增量统计）
+    void write_timestep(float time, const ecs::Registry& registry, const SimulationState& state,
+                        const process::GeneStatistics& gene_stats);
 
     // 完成导出
     void finalize();
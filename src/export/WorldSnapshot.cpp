@@ -0,0 +1,382 @@
+#include "WorldSnapshot.h"
+#include "components/Components.h"
+#include "process/EffectJournal.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+namespace {
+
+constexpr uint8_t kSnapshotMagic[4] = {'G', 'W', 'S', 'S'};
+constexpr uint16_t kSnapshotVersion = 2;
+constexpr size_t kFileHeaderSize = 8;
+constexpr size_t kFrameHeaderSize = 8;
+constexpr uint32_t kMaxKeyframeSize = 1u << 30;  // 单个关键帧负载上限（损坏的长度字段不触发巨量分配）
+
+// 快照中的组件类型标记（数值写入文件，只能追加）
+enum class SnapshotComponent : uint32_t {
+    Population = 1,
+    GameplayGene = 2,
+    SpeciesRef = 3,
+    Position = 4,
+    Lifecycle = 5,
+    LifecycleSchedule = 6,
+    Stats = 7,
+};
+
+template<typename T>
+void put(std::vector<uint8_t>& out, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "snapshot fields must be trivially copyable");
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    template<typename T>
+    bool get(T& value) {
+        if (size_ - pos_ < sizeof(T)) return false;
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool done() const { return pos_ == size_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+// 按组件池的紧凑顺序写出，恢复后遍历顺序与原Registry一致
+// 返回是否写出（Registry中没有该组件池时跳过）
+template<typename C>
+bool write_storage(std::vector<uint8_t>& out, SnapshotComponent tag, const ecs::Registry& registry) {
+    const auto* storage = registry.get_storage<C>();
+    if (!storage) {
+        return false;
+    }
+
+    const auto& entities = storage->get_entities();
+    const auto& components = storage->get_components();
+
+    put(out, static_cast<uint32_t>(tag));
+    put(out, static_cast<uint32_t>(sizeof(C)));
+    put(out, static_cast<uint32_t>(components.size()));
+    for (size_t i = 0; i < components.size(); ++i) {
+        put(out, entities[i]);
+        put(out, components[i]);
+    }
+    return true;
+}
+
+template<typename C>
+bool read_storage(SnapshotReader& in, uint32_t size, uint32_t count, ecs::Registry& registry) {
+    if (size != sizeof(C)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        EntityId entity = 0;
+        C component;
+        if (!in.get(entity) || !in.get(component) || !registry.entity_exists(entity)) {
+            return false;
+        }
+        registry.add_component(entity, std::move(component));
+    }
+    return true;
+}
+
+bool decode_keyframe(SnapshotReader& in, ecs::Registry& registry, SimulationState& state) {
+    uint64_t tick = 0;
+    uint32_t region_count = 0;
+    if (!in.get(tick) || !in.get(state.current_time) || !in.get(state.lifecycle_clock) ||
+        !in.get(state.world_seed) || !in.get(region_count)) {
+        return false;
+    }
+
+    // 1. Region的可变状态（名字、邻接关系由initialize创建）
+    for (uint32_t i = 0; i < region_count; ++i) {
+        uint32_t id = 0;
+        float food_capacity = 0.0f, current_food = 0.0f, temperature = 0.0f;
+        uint8_t mode = 0, target_mode = 0;
+        if (!in.get(id) || !in.get(food_capacity) || !in.get(current_food) ||
+            !in.get(temperature) || !in.get(mode) || !in.get(target_mode)) {
+            return false;
+        }
+
+        auto region_result = state.get_region(id);
+        if (region_result.is_err()) {
+            return false;
+        }
+        Region& region = region_result.value().get();
+        region.food_capacity = food_capacity;
+        region.current_food = current_food;
+        region.temperature = temperature;
+        region.mode = static_cast<Region::Mode>(mode);
+        region.target_mode = static_cast<Region::Mode>(target_mode);
+    }
+
+    // 2. 实体
+    registry.clear();
+
+    EntityId next_id = 1;
+    uint32_t entity_count = 0;
+    if (!in.get(next_id) || !in.get(entity_count)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < entity_count; ++i) {
+        EntityId id = 0;
+        uint8_t type = 0;
+        if (!in.get(id) || !in.get(type)) {
+            return false;
+        }
+        registry.create_entity_with_id(id, static_cast<EntityType>(type));
+    }
+    registry.set_next_entity_id(next_id);
+
+    // 3. 组件池
+    uint32_t storage_count = 0;
+    if (!in.get(storage_count)) {
+        return false;
+    }
+    for (uint32_t s = 0; s < storage_count; ++s) {
+        uint32_t tag = 0, size = 0, count = 0;
+        if (!in.get(tag) || !in.get(size) || !in.get(count)) {
+            return false;
+        }
+
+        bool ok = false;
+        switch (static_cast<SnapshotComponent>(tag)) {
+        case SnapshotComponent::Population:
+            ok = read_storage<component::Population>(in, size, count, registry);
+            break;
+        case SnapshotComponent::GameplayGene:
+            ok = read_storage<component::GameplayGene>(in, size, count, registry);
+            break;
+        case SnapshotComponent::SpeciesRef:
+            ok = read_storage<component::SpeciesRef>(in, size, count, registry);
+            break;
+        case SnapshotComponent::Position:
+            ok = read_storage<component::Position>(in, size, count, registry);
+            break;
+        case SnapshotComponent::Lifecycle:
+            ok = read_storage<component::Lifecycle>(in, size, count, registry);
+            break;
+        case SnapshotComponent::LifecycleSchedule:
+            ok = read_storage<component::LifecycleSchedule>(in, size, count, registry);
+            break;
+        case SnapshotComponent::Stats:
+            ok = read_storage<component::Stats>(in, size, count, registry);
+            break;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return in.done();
+}
+
+} // namespace
+
+// ========== WorldSnapshotWriter ==========
+
+WorldSnapshotWriter::~WorldSnapshotWriter() {
+    close();
+}
+
+core::ErrorCode WorldSnapshotWriter::open(const std::string& path) {
+    close();
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        #ifndef NDEBUG
+        std::cerr << "Error: Failed to open snapshot file: " << path << std::endl;
+        #endif
+        return core::ErrorCode::IO_ERROR;
+    }
+
+    std::vector<uint8_t> header(kSnapshotMagic, kSnapshotMagic + 4);
+    put(header, kSnapshotVersion);
+    put(header, static_cast<uint16_t>(0));
+    std::fwrite(header.data(), 1, header.size(), file_);
+
+    keyframes_written_ = 0;
+    return core::ErrorCode::OK;
+}
+
+void WorldSnapshotWriter::close() {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool WorldSnapshotWriter::needs_keyframe(const ecs::EffectRecorder& recorder) {
+    if (!recorder.each<effect::EntityCreated>().empty() ||
+        !recorder.each<effect::ComponentAdded>().empty()) {
+        return true;
+    }
+
+    const auto& destroyed = recorder.each<effect::EntityDestroyed>();
+    if (std::any_of(destroyed.begin(), destroyed.end(), [](const effect::EntityDestroyed& e) {
+            return e.reason == core::sym::HqToLqConversion || e.reason == core::sym::HqBudgetShrink;
+        })) {
+        return true;
+    }
+
+    // 生命周期模式切换会批量改写Lifecycle数值并增删LifecycleSchedule
+    const auto& region_changes = recorder.each<effect::RegionChanged>();
+    return std::any_of(region_changes.begin(), region_changes.end(), [](const effect::RegionChanged& e) {
+        return e.field == core::sym::LifecycleMode;
+    });
+}
+
+void WorldSnapshotWriter::write_keyframe(uint64_t tick, const ecs::Registry& registry,
+                                         const SimulationState& state) {
+    if (!file_) {
+        return;
+    }
+
+    payload_.clear();
+
+    // 1. 模拟状态
+    put(payload_, tick);
+    put(payload_, state.current_time);
+    put(payload_, state.lifecycle_clock);
+    put(payload_, state.world_seed);
+
+    const auto& regions = state.get_all_regions();
+    put(payload_, static_cast<uint32_t>(regions.size()));
+    for (const auto& [region_id, region] : regions) {
+        put(payload_, region_id);
+        put(payload_, region.food_capacity);
+        put(payload_, region.current_food);
+        put(payload_, region.temperature);
+        put(payload_, static_cast<uint8_t>(region.mode));
+        put(payload_, static_cast<uint8_t>(region.target_mode));
+    }
+
+    // 2. 实体（按ID排序，输出与哈希表顺序无关）
+    std::vector<std::pair<EntityId, EntityType>> entities(
+        registry.get_all_entities().begin(), registry.get_all_entities().end());
+    std::sort(entities.begin(), entities.end());
+
+    put(payload_, registry.get_next_entity_id());
+    put(payload_, static_cast<uint32_t>(entities.size()));
+    for (const auto& [id, type] : entities) {
+        put(payload_, id);
+        put(payload_, static_cast<uint8_t>(type));
+    }
+
+    // 3. 组件池（先写出存储数，再逐个写入）
+    size_t count_offset = payload_.size();
+    put(payload_, static_cast<uint32_t>(0));
+    uint32_t storage_count = 0;
+    storage_count += write_storage<component::Population>(payload_, SnapshotComponent::Population, registry);
+    storage_count += write_storage<component::GameplayGene>(payload_, SnapshotComponent::GameplayGene, registry);
+    storage_count += write_storage<component::SpeciesRef>(payload_, SnapshotComponent::SpeciesRef, registry);
+    storage_count += write_storage<component::Position>(payload_, SnapshotComponent::Position, registry);
+    storage_count += write_storage<component::Lifecycle>(payload_, SnapshotComponent::Lifecycle, registry);
+    storage_count += write_storage<component::LifecycleSchedule>(payload_, SnapshotComponent::LifecycleSchedule, registry);
+    storage_count += write_storage<component::Stats>(payload_, SnapshotComponent::Stats, registry);
+    std::memcpy(payload_.data() + count_offset, &storage_count, sizeof(storage_count));
+
+    // 4. 帧头 + 负载
+    std::vector<uint8_t> header;
+    put(header, static_cast<uint32_t>(payload_.size()));
+    put(header, ecs::crc32(payload_.data(), payload_.size()));
+    std::fwrite(header.data(), 1, header.size(), file_);
+    std::fwrite(payload_.data(), 1, payload_.size(), file_);
+    std::fflush(file_);
+
+    ++keyframes_written_;
+}
+
+// ========== WorldSnapshotReader ==========
+
+core::Result<uint64_t> WorldSnapshotReader::load_nearest(const std::string& path, uint64_t target_tick,
+                                                         ecs::Registry& registry, SimulationState& state) {
+    using R = core::Result<uint64_t>;
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return R::Err(core::ErrorCode::IO_ERROR);
+    }
+
+    uint8_t file_header[kFileHeaderSize];
+    uint16_t version = 0;
+    if (std::fread(file_header, 1, kFileHeaderSize, file) != kFileHeaderSize ||
+        std::memcmp(file_header, kSnapshotMagic, 4) != 0 ||
+        (std::memcpy(&version, file_header + 4, sizeof(version)), version != kSnapshotVersion)) {
+        std::fclose(file);
+        return R::Err(core::ErrorCode::CORRUPT_DATA);
+    }
+
+    long file_size = -1;
+    if (std::fseek(file, 0, SEEK_END) == 0) {
+        file_size = std::ftell(file);
+    }
+    if (file_size < 0 || std::fseek(file, static_cast<long>(kFileHeaderSize), SEEK_SET) != 0) {
+        std::fclose(file);
+        return R::Err(core::ErrorCode::IO_ERROR);
+    }
+
+    // 1. 只读每帧的tick，收集目标之前的关键帧（关键帧按tick递增写入）
+    // 负载长度超出文件剩余字节的帧（写到一半被中断）及其后的内容不参与定位
+    struct Candidate {
+        long offset;
+        uint32_t size;
+        uint32_t crc;
+        uint64_t tick;
+    };
+    std::vector<Candidate> candidates;
+    while (true) {
+        long offset = std::ftell(file);
+        uint32_t frame_header[2];
+        uint64_t tick = 0;
+        if (offset < 0 || std::fread(frame_header, 1, kFrameHeaderSize, file) != kFrameHeaderSize ||
+            frame_header[0] < sizeof(tick) || frame_header[0] > kMaxKeyframeSize ||
+            static_cast<long>(frame_header[0]) > file_size - offset - static_cast<long>(kFrameHeaderSize) ||
+            std::fread(&tick, 1, sizeof(tick), file) != sizeof(tick)) {
+            break;
+        }
+        if (tick > target_tick) {
+            break;
+        }
+        candidates.push_back({offset, frame_header[0], frame_header[1], tick});
+        if (std::fseek(file, static_cast<long>(frame_header[0] - sizeof(tick)), SEEK_CUR) != 0) {
+            break;
+        }
+    }
+
+    if (candidates.empty()) {
+        std::fclose(file);
+        return R::Err(core::ErrorCode::NOT_FOUND);
+    }
+
+    // 2. 从最近的关键帧往前，使用第一个通过CRC校验并能完整解码的
+    std::vector<uint8_t> payload;
+    for (auto it = candidates.rbegin(); it != candidates.rend(); ++it) {
+        payload.resize(it->size);
+        if (std::fseek(file, it->offset + static_cast<long>(kFrameHeaderSize), SEEK_SET) != 0 ||
+            std::fread(payload.data(), 1, payload.size(), file) != payload.size() ||
+            ecs::crc32(payload.data(), payload.size()) != it->crc) {
+            continue;
+        }
+
+        SnapshotReader in(payload.data(), payload.size());
+        if (decode_keyframe(in, registry, state)) {
+            std::fclose(file);
+            uint64_t tick = it->tick;
+            return R::Ok(std::move(tick));
+        }
+    }
+
+    std::fclose(file);
+    return R::Err(core::ErrorCode::CORRUPT_DATA);
+}
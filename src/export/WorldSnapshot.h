@@ -0,0 +1,59 @@
+#pragma once
+
+#include "ecs/Registry.h"
+#include "process/EffectRecorder.h"
+#include "simulation/SimulationState.h"
+#include "core/Result.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// ============================================================
+// 世界快照（关键帧）- Registry + SimulationState 的完整二进制副本
+// 与Effect日志配合回放：加载不晚于目标tick的最近关键帧，再应用其后的日志帧。
+//
+// 文件 = "GWSS" | u16 版本 | u16 保留 | 若干关键帧
+// 关键帧 = u32 负载长度 | u32 CRC32(负载) | 负载
+// 负载以 u64 tick 开头，定位时只读tick，其余部分直接跳过。
+// 组件按本机内存布局整体写入（附带sizeof校验），只用于同一构建的调试/回放。
+// Appearance由GeneSystem从GameplayGene重新生成，不写入快照。
+// ============================================================
+
+class WorldSnapshotWriter {
+public:
+    WorldSnapshotWriter() = default;
+    ~WorldSnapshotWriter();
+
+    WorldSnapshotWriter(const WorldSnapshotWriter&) = delete;
+    WorldSnapshotWriter& operator=(const WorldSnapshotWriter&) = delete;
+
+    // 创建（覆盖）快照文件
+    core::ErrorCode open(const std::string& path);
+
+    // 追加一个关键帧（tick为已写入日志的最后一帧）
+    void write_keyframe(uint64_t tick, const ecs::Registry& registry, const SimulationState& state);
+
+    void close();
+
+    bool is_open() const { return file_ != nullptr; }
+    uint64_t get_keyframes_written() const { return keyframes_written_; }
+
+    // 本步是否包含Effect无法完整描述的变化（新实体的组件数值、HQ/LQ切换、HQ预算缩减、
+    // 生命周期模式切换），这些tick必须写关键帧，回放才能与原模拟一致
+    static bool needs_keyframe(const ecs::EffectRecorder& recorder);
+
+private:
+    std::FILE* file_ = nullptr;
+    std::vector<uint8_t> payload_;
+    uint64_t keyframes_written_ = 0;
+};
+
+class WorldSnapshotReader {
+public:
+    // 加载tick不大于target_tick的最近关键帧到registry/state（state需已initialize）
+    // 最近的关键帧损坏（CRC不匹配、写入中断）时退回更早的关键帧
+    // 返回关键帧的tick；没有合适的关键帧返回NOT_FOUND，候选关键帧全部损坏返回CORRUPT_DATA
+    static core::Result<uint64_t> load_nearest(const std::string& path, uint64_t target_tick,
+                                               ecs::Registry& registry, SimulationState& state);
+};
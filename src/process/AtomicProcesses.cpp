@@ -42,24 +42,9 @@ void UpdatePopulationGrowth::execute(ProcessContext& ctx, EntityId pop_id, float
 
     float dN = growth_rate * pop.estimated_count * dt - predation_loss * dt;
 
-    // 更新种群数量（确保非负）
+    // 更新种群数量（确保非负）并记录Effect
     float new_count_f = std::max(0.0f, static_cast<float>(old_count) + dN);
-    pop.estimated_count = static_cast<uint32_t>(new_count_f);
-
-    // 记录Effect
-    if (pop.estimated_count != old_count) {
-        ctx.record(effect::ResourceChanged{
-            pop_id,
-            "estimated_count",
-            static_cast<float>(old_count),
-            static_cast<float>(pop.estimated_count)
-        });
-    }
-
-    // 检查灭绝
-    if (pop.estimated_count == 0 && old_count > 0) {
-        ctx.record(effect::Death{pop_id, "population_extinction"});
-    }
+    dynamics::commit_count(ctx, pop_id, pop, static_cast<uint32_t>(new_count_f));
 }
 
 float UpdatePopulationGrowth::calculate_growth_rate(const component::Population& pop,
@@ -69,8 +54,8 @@ float UpdatePopulationGrowth::calculate_growth_rate(const component::Population&
     // r = birth_rate - death_rate
     float r = pop.birth_rate - pop.death_rate;
 
-    // Carrying capacity: K = food_capacity / food_requirement
-    float K = region.food_capacity / species.food_requirement;
+    // Carrying capacity: K = current_food / food_requirement（实时食物，未启用食物动态时等于food_capacity）
+    float K = region.current_food / species.food_requirement;
 
     // Logistic factor: (1 - N/K)
     float logistic_factor = 1.0f - (pop.estimated_count / K);
@@ -124,8 +109,9 @@ float UpdatePopulationGrowth::calculate_predation_loss(const component::Populati
 
 // ========== Process 2: SpawnCreaturesFromPopulation ==========
 
-void SpawnCreaturesFromPopulation::execute(ProcessContext& ctx, EntityId pop_id, uint32_t count) {
-    const auto& pop = ctx.get<component::Population>(pop_id);
+void SpawnCreaturesFromPopulation::execute(ProcessContext& ctx, EntityId pop_id, uint32_t count,
+                                           std::vector<EntityId>* spawned) {
+    auto& pop = ctx.get<component::Population>(pop_id);
 
     auto species_result = ctx.get_species_template(pop.species_id);
     if (species_result.is_err()) {
@@ -139,14 +125,25 @@ void SpawnCreaturesFromPopulation::execute(ProcessContext& ctx, EntityId pop_id,
     // 限制最大生成数量
     const uint32_t MAX_SPAWN = 200;
     count = std::min(count, MAX_SPAWN);
-    count = std::min(count, pop.estimated_count);
+    // 只从尚未生成个体的LQ余量中生成
+    uint32_t remainder = pop.estimated_count > pop.individual_count
+        ? pop.estimated_count - pop.individual_count : 0;
+    count = std::min(count, remainder);
 
+    // 1. 创建Creature实体
+    spawn_ids_.clear();
     for (uint32_t i = 0; i < count; ++i) {
-        // 1. 创建Creature实体
-        EntityId creature_id = ctx.create_entity(EntityType::Creature);
+        spawn_ids_.push_back(ctx.create_entity(EntityType::Creature));
+    }
 
-        // 2. 采样基因
-        GameplayGene gene = sample_gene_from_distribution(pop, species, i);
+    // 2. 整批采样基因（随机流由世界种子和个体ID决定，与生成顺序无关）
+    GeneSampler sampler(pop, species);
+    spawn_genes_.resize(count);
+    sampler.sample_batch(spawn_ids_.data(), count, ctx.get_state().world_seed, spawn_genes_.data());
+
+    for (uint32_t i = 0; i < count; ++i) {
+        EntityId creature_id = spawn_ids_[i];
+        const GameplayGene& gene = spawn_genes_[i];
 
         // 3. 添加组件
         ctx.get_registry().add_component(creature_id, component::GameplayGene{gene});
@@ -157,20 +154,27 @@ void SpawnCreaturesFromPopulation::execute(ProcessContext& ctx, EntityId pop_id,
         });
 
         // 4. 添加生命周期组件
-        std::uniform_real_distribution<float> age_dist(0.0f, species.maturity_age);
+        core::CounterRng life_rng(ctx.get_state().world_seed, creature_id, core::RngStream::Lifecycle);
         ctx.get_registry().add_component(creature_id, component::Lifecycle{
-            age_dist(rng_),              // 随机年龄
+            life_rng.uniform(0.0f, species.maturity_age),  // 随机年龄
             species.average_lifespan,    // 预期寿命
             0.0f,                        // 初始无饥饿
             1.0f                         // 满健康
         });
 
-        ctx.record(effect::ComponentAdded{creature_id, "GameplayGene"});
-        ctx.record(effect::ComponentAdded{creature_id, "SpeciesRef"});
-        ctx.record(effect::ComponentAdded{creature_id, "Position"});
-        ctx.record(effect::ComponentAdded{creature_id, "Lifecycle"});
+        ctx.record(effect::ComponentAdded{creature_id, core::sym::GameplayGene});
+        ctx.record(effect::ComponentAdded{creature_id, core::sym::SpeciesRef});
+        ctx.record(effect::ComponentAdded{creature_id, core::sym::Position});
+        ctx.record(effect::ComponentAdded{creature_id, core::sym::Lifecycle});
+        ctx.track_creature(creature_id);
+
+        if (spawned) {
+            spawned->push_back(creature_id);
+        }
     }
 
+    pop.individual_count += count;
+
     std::cout << "[SpawnCreaturesFromPopulation] Spawned " << count << " creatures of species "
               << pop.species_id << " in region " << pop.region_id << std::endl;
 }
@@ -178,45 +182,8 @@ void SpawnCreaturesFromPopulation::execute(ProcessContext& ctx, EntityId pop_id,
 GameplayGene SpawnCreaturesFromPopulation::sample_gene_from_distribution(
     const component::Population& pop,
     const SpeciesTemplate& species,
-    uint32_t seed) {
-
-    std::mt19937 local_rng(seed + static_cast<uint32_t>(pop.species_id) * 1000);
-
-    GameplayGene gene;
-
-    // 从正态分布采样（使用种群统计数据或物种模板）
-    std::normal_distribution<float> limb_dist(
-        pop.avg_limb_length > 0 ? pop.avg_limb_length : species.limb_length_mean,
-        pop.std_limb_length > 0 ? pop.std_limb_length : species.limb_length_std
-    );
-    std::normal_distribution<float> mass_dist(
-        pop.avg_body_mass > 0 ? pop.avg_body_mass : species.body_mass_mean,
-        pop.std_body_mass > 0 ? pop.std_body_mass : species.body_mass_std
-    );
-    std::normal_distribution<float> scale_dist(
-        pop.avg_size_scale > 0 ? pop.avg_size_scale : species.size_scale_mean,
-        pop.std_size_scale > 0 ? pop.std_size_scale : species.size_scale_std
-    );
-
-    gene.limb_length = std::max(0.1f, limb_dist(local_rng));
-    gene.body_mass = std::max(0.1f, mass_dist(local_rng));
-    gene.size_scale = std::max(0.5f, scale_dist(local_rng));
-
-    // 其他属性使用物种默认值
-    std::normal_distribution<float> str_dist(species.base_strength_mean, species.base_strength_std);
-    std::normal_distribution<float> agi_dist(species.base_agility_mean, species.base_agility_std);
-    std::normal_distribution<float> end_dist(species.base_endurance_mean, species.base_endurance_std);
-    std::normal_distribution<float> int_dist(species.base_intellect_mean, species.base_intellect_std);
-
-    gene.base_strength = std::max(1.0f, str_dist(local_rng));
-    gene.base_agility = std::max(1.0f, agi_dist(local_rng));
-    gene.base_endurance = std::max(1.0f, end_dist(local_rng));
-    gene.base_intellect = std::max(1.0f, int_dist(local_rng));
-
-    gene.has_wings = false;
-    gene.has_horn = false;
-
-    return gene;
+    core::CounterRng& rng) {
+    return GeneSampler(pop, species).sample(rng);
 }
 
 // ========== Process 3: AggregateCreaturesToPopulation ==========
@@ -254,87 +221,47 @@ void AggregateCreaturesToPopulation::execute(ProcessContext& ctx, uint32_t regio
             species.base_birth_rate,
             species.base_death_rate,
             component::Population::Mode::DerivedFromIndividuals,
-            0, 0, 0, 0, 0, 0  // 统计数据待计算
+            0.0f, 0.0f, 0.0f,  // 性状均值（待计算）
+            0.0f, 0.0f, 0.0f,  // 性状标准差
+            0.0f, 0.0f, 0.0f,  // 性状相关系数
+            0,                 // individual_count
+            0.0f               // count_remainder
         });
     }
 
-    // 2. 收集该区域内所有该物种的Creature
-    std::vector<GameplayGene> genes;
-    const auto& all_creatures = ctx.get_registry().view<component::SpeciesRef>();
+    // 2. 存活个体的基因统计（生成/死亡/迁移时增量维护，无需扫描个体）
+    const process::GeneMoments* moments = ctx.get_gene_stats().find(region_id, species_id);
+    uint32_t alive = moments ? moments->count() : 0;
 
-    for (EntityId cid : all_creatures) {
-        if (!ctx.has<component::Position>(cid) || !ctx.has<component::GameplayGene>(cid)) {
-            continue;
-        }
-
-        const auto& species_ref = ctx.get<component::SpeciesRef>(cid);
-        const auto& pos = ctx.get<component::Position>(cid);
-
-        if (pos.region_id == region_id && species_ref.species_id == species_id) {
-            const auto& gene_comp = ctx.get<component::GameplayGene>(cid);
-            genes.push_back(gene_comp.gene);
-        }
-    }
-
-    // 3. 计算统计数据
+    // 3. 更新种群数据
+    // 未生成个体的LQ余量（分帧转换中途切回LQ时）与存活个体合并
     auto& pop = ctx.get<component::Population>(pop_id);
     uint32_t old_count = pop.estimated_count;
-    pop.estimated_count = static_cast<uint32_t>(genes.size());
-
-    calculate_statistics(genes, pop);
+    uint32_t remainder = pop.estimated_count > pop.individual_count
+        ? pop.estimated_count - pop.individual_count : 0;
+    dynamics::store_count(pop, alive + remainder);
+    pop.individual_count = 0;
+
+    // 没有存活个体时保留余量原有的统计分布
+    if (moments) {
+        moments->write_to(pop);
+    } else if (remainder == 0) {
+        process::GeneMoments{}.write_to(pop);
+    }
 
     // 4. 记录Effect
     ctx.record(effect::ResourceChanged{
         pop_id,
-        "estimated_count",
+        core::sym::EstimatedCount,
         static_cast<float>(old_count),
         static_cast<float>(pop.estimated_count)
     });
 
-    std::cout << "[AggregateCreaturesToPopulation] Aggregated " << genes.size()
+    std::cout << "[AggregateCreaturesToPopulation] Aggregated " << alive
               << " creatures into population " << pop_id << " (species " << species_id
               << ", region " << region_id << ")" << std::endl;
 }
 
-void AggregateCreaturesToPopulation::calculate_statistics(
-    const std::vector<GameplayGene>& genes,
-    component::Population& pop) {
-
-    if (genes.empty()) {
-        pop.avg_limb_length = 0;
-        pop.avg_body_mass = 0;
-        pop.avg_size_scale = 0;
-        pop.std_limb_length = 0;
-        pop.std_body_mass = 0;
-        pop.std_size_scale = 0;
-        return;
-    }
-
-    // 计算均值
-    float sum_limb = 0, sum_mass = 0, sum_scale = 0;
-    for (const auto& gene : genes) {
-        sum_limb += gene.limb_length;
-        sum_mass += gene.body_mass;
-        sum_scale += gene.size_scale;
-    }
-
-    pop.avg_limb_length = sum_limb / genes.size();
-    pop.avg_body_mass = sum_mass / genes.size();
-    pop.avg_size_scale = sum_scale / genes.size();
-
-    // 计算标准差
-    float var_limb = 0, var_mass = 0, var_scale = 0;
-    for (const auto& gene : genes) {
-        var_limb += (gene.limb_length - pop.avg_limb_length) * (gene.limb_length - pop.avg_limb_length);
-        var_mass += (gene.body_mass - pop.avg_body_mass) * (gene.body_mass - pop.avg_body_mass);
-        var_scale += (gene.size_scale - pop.avg_size_scale) * (gene.size_scale - pop.avg_size_scale);
-    }
-
-    pop.std_limb_length = std::sqrt(var_limb / genes.size());
-    pop.std_body_mass = std::sqrt(var_mass / genes.size());
-    pop.std_size_scale = std::sqrt(var_scale / genes.size());
-}
-
 // ========== Process 4: ProcessCreatureLifecycle ==========
 
 void ProcessCreatureLifecycle::execute(ProcessContext& ctx, EntityId creature_id, float dt) {
@@ -351,17 +278,14 @@ void ProcessCreatureLifecycle::execute(ProcessContext& ctx, EntityId creature_id
     life.age += dt;
 
     // 2. 饥饿增加（简化：每天增加0.1）
-    life.hunger += 0.1f * dt;
+    life.hunger += lifecycle::kHungerPerDay * dt;
     life.hunger = std::min(1.0f, life.hunger);
 
     // 3. 检查死亡条件
     bool should_die = check_death_conditions(life);
 
     if (should_die) {
-        std::string cause = "unknown";
-        if (life.hunger > 0.95f) cause = "starvation";
-        else if (life.health < 0.05f) cause = "illness";
-        else if (life.age > life.lifespan) cause = "old_age";
+        core::Symbol cause = lifecycle::death_cause(lifecycle::death_causes(life));
 
         ctx.record(effect::Death{creature_id, cause});
         ctx.destroy_entity(creature_id, cause);
@@ -369,22 +293,104 @@ void ProcessCreatureLifecycle::execute(ProcessContext& ctx, EntityId creature_id
         // 记录变化
         if (std::abs(life.age - old_age) > 0.01f) {
             ctx.record(effect::ResourceChanged{
-                creature_id, "age", old_age, life.age
+                creature_id, core::sym::Age, old_age, life.age
             });
         }
         if (std::abs(life.hunger - old_hunger) > 0.01f) {
             ctx.record(effect::ResourceChanged{
-                creature_id, "hunger", old_hunger, life.hunger
+                creature_id, core::sym::Hunger, old_hunger, life.hunger
             });
         }
     }
 }
 
+void ProcessCreatureLifecycle::execute_batch(ProcessContext& ctx, float dt,
+                                             ecs::EffectShardSet& shards, WorkerPool* pool) {
+    auto* storage = ctx.get_registry().get_storage<component::Lifecycle>();
+    if (!storage) {
+        return;
+    }
+
+    auto& lives = storage->get_components();
+    const auto& entities = storage->get_entities();
+    const size_t count = lives.size();
+
+    // 按固定大小切块，块的划分与线程数无关
+    const size_t chunk_count = (count + kChunkSize - 1) / kChunkSize;
+    auto& chunk_shards = shards.prepare(kShardSystem, chunk_count);
+    if (chunk_dying_.size() < chunk_count) {
+        chunk_dying_.resize(chunk_count);
+    }
+
+    auto run_chunk = [&](size_t c) {
+        size_t begin = c * kChunkSize;
+        size_t len = std::min(kChunkSize, count - begin);
+        process_chunk(lives.data() + begin, entities.data() + begin, len, dt,
+                      chunk_dying_[c], chunk_shards[c]);
+    };
+
+    // 1. 并行处理各块：每块只写自己的分片和死亡列表
+    if (pool && pool->size() > 1) {
+        pool->parallel_for(chunk_count, run_chunk);
+    } else {
+        for (size_t c = 0; c < chunk_count; ++c) {
+            run_chunk(c);
+        }
+    }
+
+    // 2. 死亡个体按块顺序交给延迟销毁（遍历结束后统一执行）
+    for (size_t c = 0; c < chunk_count; ++c) {
+        const auto& dying = chunk_dying_[c];
+        size_t begin = c * kChunkSize;
+        for (size_t k = 0; k < dying.size(); ++k) {
+            ctx.defer_destroy(entities[begin + dying.indices[k]], lifecycle::death_cause(dying.causes[k]));
+        }
+    }
+}
+
+void ProcessCreatureLifecycle::process_chunk(component::Lifecycle* lives, const EntityId* entities,
+                                             size_t count, float dt,
+                                             lifecycle::DyingList& dying, ecs::EffectShard& shard) {
+    // 1. 向量化更新年龄/饥饿，收集死亡个体
+    dying.clear();
+    lifecycle::update_and_collect(lives, count, dt, dying);
+
+    // 2. 存活个体的变化记录
+    // 存活个体饥饿度不超过阈值，未被截断，因此变化量对所有个体相同
+    const float hunger_step = lifecycle::kHungerPerDay * dt;
+    const bool record_age = std::abs(dt) > 0.01f;
+    const bool record_hunger = std::abs(hunger_step) > 0.01f;
+
+    if (record_age || record_hunger) {
+        size_t next_dying = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (next_dying < dying.size() && dying.indices[next_dying] == i) {
+                ++next_dying;
+                continue;
+            }
+
+            const auto& life = lives[i];
+            if (record_age) {
+                shard.record(effect::ResourceChanged{
+                    entities[i], core::sym::Age, life.age - dt, life.age
+                });
+            }
+            if (record_hunger) {
+                shard.record(effect::ResourceChanged{
+                    entities[i], core::sym::Hunger, life.hunger - hunger_step, life.hunger
+                });
+            }
+        }
+    }
+
+    // 3. 死亡个体记录Death（销毁由调用方串行完成）
+    for (size_t k = 0; k < dying.size(); ++k) {
+        shard.record(effect::Death{entities[dying.indices[k]], lifecycle::death_cause(dying.causes[k])});
+    }
+}
+
 bool ProcessCreatureLifecycle::check_death_conditions(const component::Lifecycle& life) {
-    if (life.hunger > 0.95f) return true;
-    if (life.health < 0.05f) return true;
-    if (life.age > life.lifespan) return true;
-    return false;
+    return lifecycle::death_causes(life) != 0;
 }
 
 // ========== Process 5: ProcessMigration ==========
@@ -402,6 +408,7 @@ void ProcessMigration::execute(ProcessContext& ctx, EntityId entity_id, uint32_t
         return;
     }
 
+    ctx.move_creature(entity_id, target_region);
     pos.region_id = target_region;
 
     ctx.record(effect::Migration{
@@ -412,4 +419,106 @@ void ProcessMigration::execute(ProcessContext& ctx, EntityId entity_id, uint32_t
     });
 }
 
+// ========== Process 6: FastForwardPopulations ==========
+
+void FastForwardPopulations::execute(ProcessContext& ctx, uint32_t region_id, float elapsed) {
+    if (elapsed <= 0.0f) {
+        return;
+    }
+
+    if (!dynamics::build_region_batch(ctx, region_id, batch_)) {
+        return;
+    }
+
+    if (batch_.has_active_predation()) {
+        // 捕食者-猎物耦合：自适应步长数值积分
+        integrator_.integrate(batch_, static_cast<double>(elapsed));
+    } else {
+        // 各种群相互独立：直接使用Logistic解析解
+        for (size_t i = 0; i < batch_.size(); ++i) {
+            if (batch_.simulated[i]) {
+                batch_.count[i] = dynamics::logistic_closed_form(
+                    batch_.count[i], batch_.r[i], batch_.K[i], elapsed);
+            }
+        }
+    }
+
+    dynamics::commit_batch(ctx, batch_);
+}
+
+// ========== Process 7: UpdateRepresentativeSamples ==========
+
+void UpdateRepresentativeSamples::execute(ProcessContext& ctx, EntityId pop_id, float dt,
+                                          const Options& options) {
+    const auto& pop = ctx.get<component::Population>(pop_id);
+    auto& visual = ctx.get<component::PopulationSamples>(pop_id);
+
+    auto species_result = ctx.get_species_template(pop.species_id);
+    auto region_result = ctx.get_region(pop.region_id);
+    if (species_result.is_err() || region_result.is_err()) {
+        return;
+    }
+    const auto& species = species_result.value().get();
+    const auto& region = region_result.value().get();
+
+    // 1. 目标样本数
+    uint32_t target = 0;
+    if (pop.estimated_count > 0) {
+        uint32_t per_sample = std::max(1u, options.individuals_per_sample);
+        target = (pop.estimated_count + per_sample - 1) / per_sample;
+        target = std::clamp(target, 1u, std::max(1u, options.max_samples));
+    }
+
+    auto& samples = visual.samples;
+    if (samples.size() > target) {
+        samples.resize(target);
+    }
+
+    // 2. 衰老，到寿命的样本由新生样本替换
+    for (auto& sample : samples) {
+        sample.lifecycle.age += dt;
+        if (sample.lifecycle.age >= sample.lifecycle.lifespan) {
+            sample = draw_sample(ctx, pop_id, pop, species, visual, true);
+        }
+    }
+
+    while (samples.size() < target) {
+        samples.push_back(draw_sample(ctx, pop_id, pop, species, visual, false));
+    }
+
+    // 3. 饥饿度反映Region的食物余量（驱动进食动画）
+    float hunger = region.food_capacity > 0.0f
+        ? std::clamp(1.0f - region.current_food / region.food_capacity, 0.0f, 1.0f)
+        : 0.0f;
+    for (auto& sample : samples) {
+        sample.lifecycle.hunger = hunger;
+    }
+
+    visual.weight = samples.empty()
+        ? 0.0f : static_cast<float>(pop.estimated_count) / static_cast<float>(samples.size());
+}
+
+component::RepresentativeSample UpdateRepresentativeSamples::draw_sample(
+    ProcessContext& ctx, EntityId pop_id,
+    const component::Population& pop,
+    const SpeciesTemplate& species,
+    component::PopulationSamples& visual,
+    bool newborn) {
+
+    // 随机流由种群ID和样本序号决定
+    uint64_t stream_id = (static_cast<uint64_t>(pop_id) << 32) | visual.next_serial++;
+    core::CounterRng rng(ctx.get_state().world_seed, stream_id, core::RngStream::Sample);
+
+    component::RepresentativeSample sample;
+    sample.gene = SpawnCreaturesFromPopulation::sample_gene_from_distribution(pop, species, rng);
+    sample.lifecycle = component::Lifecycle{
+        newborn ? 0.0f : rng.uniform(0.0f, species.maturity_age),
+        species.average_lifespan,
+        0.0f,
+        1.0f
+    };
+    sample.local_pos = Vec3{rng.uniform(-45.0f, 45.0f), 0.0f, rng.uniform(-45.0f, 45.0f)};
+    return sample;
+}
+
 } // namespace process
@@ -2,7 +2,13 @@
 
 #include "ProcessContext.h"
 #include "components/Components.h"
-#include <random>
+#include "LifecycleKernel.h"
+#include "PopulationDynamics.h"
+#include "Integrator.h"
+#include "EffectShards.h"
+#include "GeneSampler.h"
+#include "WorkerPool.h"
+#include "core/Random.h"
 
 // ============================================================
 // 原子Process库
@@ -12,6 +18,8 @@
 // 3. AggregateCreaturesToPopulation - 个体聚合到种群（HQ→LQ）
 // 4. ProcessCreatureLifecycle - 个体生命周期（HQ模式）
 // 5. ProcessMigration - 迁移（暂时简化）
+// 6. FastForwardPopulations - 长时间未更新的LQ区域一次性追赶
+// 7. UpdateRepresentativeSamples - MQ区域的代表个体样本
 // ============================================================
 
 namespace process {
@@ -37,30 +45,30 @@ private:
 };
 
 // ========== Process 2: SpawnCreaturesFromPopulation ==========
-// 从种群统计分布采样生成N个个体
+// 从种群统计分布（含性状相关性）整批采样生成N个个体
 class SpawnCreaturesFromPopulation {
 public:
-    void execute(ProcessContext& ctx, EntityId pop_id, uint32_t count);
+    // spawned非空时追加新生成个体的ID
+    void execute(ProcessContext& ctx, EntityId pop_id, uint32_t count,
+                 std::vector<EntityId>* spawned = nullptr);
 
-private:
-    GameplayGene sample_gene_from_distribution(
+    // 按种群统计（缺省时用物种模板）的多元正态分布采样单个基因
+    static GameplayGene sample_gene_from_distribution(
         const component::Population& pop,
         const SpeciesTemplate& species,
-        uint32_t seed);
+        core::CounterRng& rng);
 
-    std::mt19937 rng_{std::random_device{}()};
+private:
+    // 批量生成的暂存区（跨调用复用）
+    std::vector<EntityId> spawn_ids_;
+    std::vector<GameplayGene> spawn_genes_;
 };
 
 // ========== Process 3: AggregateCreaturesToPopulation ==========
-// 统计区域内所有某物种的个体，更新种群数据
+// 用区域内某物种存活个体的增量基因统计更新种群数据（O(1)，不扫描个体）
 class AggregateCreaturesToPopulation {
 public:
     void execute(ProcessContext& ctx, uint32_t region_id, SpeciesId species_id);
-
-private:
-    void calculate_statistics(
-        const std::vector<GameplayGene>& genes,
-        component::Population& pop);
 };
 
 // ========== Process 4: ProcessCreatureLifecycle ==========
@@ -69,8 +77,24 @@ class ProcessCreatureLifecycle {
 public:
     void execute(ProcessContext& ctx, EntityId creature_id, float dt);
 
+    // 批量版本：按固定大小分块向量化遍历Lifecycle组件池，死亡个体交给延迟销毁
+    // 各块的Effect写入shards中本Process的分片，由调用方在屏障处归并；
+    // 传入线程池时各块由池中线程并行处理，归并结果与线程数无关
+    void execute_batch(ProcessContext& ctx, float dt, ecs::EffectShardSet& shards, WorkerPool* pool = nullptr);
+
+    // 在EffectShardSet中的系统ID（归并顺序）
+    static constexpr uint32_t kShardSystem = 4;
+
+    // 每块的个体数（kLanes的整数倍）
+    static constexpr size_t kChunkSize = 4096;
+
 private:
     bool check_death_conditions(const component::Lifecycle& life);
+
+    void process_chunk(component::Lifecycle* lives, const EntityId* entities, size_t count, float dt,
+                       lifecycle::DyingList& dying, ecs::EffectShard& shard);
+
+    std::vector<lifecycle::DyingList> chunk_dying_;  // 复用的每块死亡列表
 };
 
 // ========== Process 5: ProcessMigration ==========
@@ -80,4 +104,39 @@ public:
     void execute(ProcessContext& ctx, EntityId entity_id, uint32_t target_region);
 };
 
+// ========== Process 6: FastForwardPopulations ==========
+// 一次性推进Region内所有LQ种群elapsed时间（多速率跳过、读档后追赶）
+// 无捕食时使用Logistic解析解（O(1)）；存在捕食关系时用RK45大步长自适应积分
+class FastForwardPopulations {
+public:
+    void execute(ProcessContext& ctx, uint32_t region_id, float elapsed);
+
+    dynamics::PopulationIntegrator& get_integrator() { return integrator_; }
+
+private:
+    dynamics::PopulationIntegrator integrator_{dynamics::IntegratorMode::RK45, dynamics::IntegratorOptions{}};
+    dynamics::RegionBatch batch_;  // 复用的缓冲
+};
+
+// ========== Process 7: UpdateRepresentativeSamples ==========
+// MQ区域：为LQ种群维护少量代表个体（PopulationSamples组件）
+// 样本数随估计数量变化（每individuals_per_sample个个体一个样本，最多max_samples个），
+// 样本照常衰老，到寿命后由按当前分布采样的新生样本替换；不修改种群统计、不产生Effect
+class UpdateRepresentativeSamples {
+public:
+    struct Options {
+        uint32_t max_samples = 12;
+        uint32_t individuals_per_sample = 10;
+    };
+
+    void execute(ProcessContext& ctx, EntityId pop_id, float dt, const Options& options);
+
+private:
+    component::RepresentativeSample draw_sample(ProcessContext& ctx, EntityId pop_id,
+                                                const component::Population& pop,
+                                                const SpeciesTemplate& species,
+                                                component::PopulationSamples& visual,
+                                                bool newborn);
+};
+
 } // namespace process
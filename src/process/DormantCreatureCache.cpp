@@ -0,0 +1,100 @@
+#include "DormantCreatureCache.h"
+#include "LifecycleKernel.h"
+#include <iterator>
+
+namespace process {
+
+void DormantCreatureCache::set_config(const Config& config) {
+    config_ = config;
+    enforce_budget();
+}
+
+void DormantCreatureCache::store(uint32_t region_id, SpeciesId species_id, double time,
+                                 std::vector<DormantCreature>&& creatures) {
+    erase(region_id, species_id);
+    if (!is_enabled() || creatures.empty()) {
+        return;
+    }
+
+    stats_.stored += creatures.size();
+    creatures.shrink_to_fit();
+
+    lru_.push_front({region_id, species_id, time, std::move(creatures)});
+    index_[key(region_id, species_id)] = lru_.begin();
+    bytes_ += entry_bytes(lru_.front());
+
+    enforce_budget();
+}
+
+bool DormantCreatureCache::take(uint32_t region_id, SpeciesId species_id, double now, DormantCreature& out) {
+    auto found = index_.find(key(region_id, species_id));
+    if (found == index_.end()) {
+        return false;
+    }
+
+    auto it = found->second;
+    float elapsed = static_cast<float>(now - it->demoted_time);
+    if (elapsed > config_.max_dormant_time) {
+        remove(it);
+        return false;
+    }
+
+    auto& creatures = it->creatures;
+    while (!creatures.empty()) {
+        DormantCreature creature = creatures.back();
+        creatures.pop_back();
+
+        // 休眠期间照常衰老、饥饿，按与生命周期内核相同的死亡条件判定
+        creature.lifecycle = lifecycle::project(creature.lifecycle, elapsed);
+        if (lifecycle::death_causes(creature.lifecycle) != 0) {
+            ++stats_.expired;
+            continue;
+        }
+
+        ++stats_.restored;
+        out = creature;
+        return true;
+    }
+
+    return false;
+}
+
+void DormantCreatureCache::erase(uint32_t region_id, SpeciesId species_id) {
+    auto found = index_.find(key(region_id, species_id));
+    if (found != index_.end()) {
+        remove(found->second);
+    }
+}
+
+void DormantCreatureCache::clear() {
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+size_t DormantCreatureCache::get_creature_count() const {
+    size_t total = 0;
+    for (const auto& entry : lru_) {
+        total += entry.creatures.size();
+    }
+    return total;
+}
+
+void DormantCreatureCache::remove(std::list<Entry>::iterator it) {
+    stats_.expired += it->creatures.size();
+    bytes_ -= entry_bytes(*it);
+    index_.erase(key(it->region_id, it->species_id));
+    lru_.erase(it);
+}
+
+void DormantCreatureCache::enforce_budget() {
+    while (!lru_.empty() && bytes_ > config_.max_bytes) {
+        auto oldest = std::prev(lru_.end());
+        stats_.evicted += oldest->creatures.size();
+        bytes_ -= entry_bytes(*oldest);
+        index_.erase(key(oldest->region_id, oldest->species_id));
+        lru_.erase(oldest);
+    }
+}
+
+} // namespace process
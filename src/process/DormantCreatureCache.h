@@ -0,0 +1,92 @@
+#pragma once
+
+#include "components/Components.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================
+// 休眠个体缓存
+// HQ→LQ时把即将销毁的个体压缩保存（ID、基因、生命周期、位置），
+// 相机在时间窗口内返回时直接恢复这些个体，而不是重新采样新个体。
+// 按(Region, 物种)保存，总内存超出预算时淘汰最久未降级的条目（LRU）。
+// ============================================================
+
+namespace process {
+
+// 压缩后的休眠个体
+struct DormantCreature {
+    EntityId id;
+    ::GameplayGene gene;
+    component::Lifecycle lifecycle;
+    Vec3 local_pos;
+};
+
+class DormantCreatureCache {
+public:
+    struct Config {
+        size_t max_bytes = 4 * 1024 * 1024;  // 内存预算（0表示禁用缓存）
+        float max_dormant_time = 30.0f;      // 超过该时长（天）的条目不再恢复
+    };
+
+    struct Stats {
+        uint64_t stored = 0;     // 存入的个体数
+        uint64_t restored = 0;   // 恢复的个体数
+        uint64_t evicted = 0;    // 因预算淘汰的个体数
+        uint64_t expired = 0;    // 因超时、未使用或休眠期间死亡而丢弃的个体数
+    };
+
+    DormantCreatureCache() = default;
+    explicit DormantCreatureCache(const Config& config) : config_(config) {}
+
+    void set_config(const Config& config);
+    const Config& get_config() const { return config_; }
+    bool is_enabled() const { return config_.max_bytes > 0; }
+
+    // 保存某Region某物种降级时的个体（覆盖旧条目），超出预算时淘汰最旧的条目
+    void store(uint32_t region_id, SpeciesId species_id, double time, std::vector<DormantCreature>&& creatures);
+
+    // 取出一个可恢复的个体：年龄和饥饿度按休眠时长推进，满足死亡条件（衰老/饥饿/疾病）的个体丢弃
+    // 条目不存在、已超时或已取空时返回false
+    bool take(uint32_t region_id, SpeciesId species_id, double now, DormantCreature& out);
+
+    // 丢弃某Region某物种的条目（转换完成后剩余的个体不再恢复）
+    void erase(uint32_t region_id, SpeciesId species_id);
+
+    void clear();
+
+    size_t get_bytes() const { return bytes_; }
+    size_t get_creature_count() const;
+    const Stats& get_stats() const { return stats_; }
+
+private:
+    struct Entry {
+        uint32_t region_id;
+        SpeciesId species_id;
+        double demoted_time;
+        std::vector<DormantCreature> creatures;
+    };
+
+    static uint64_t key(uint32_t region_id, SpeciesId species_id) {
+        return (static_cast<uint64_t>(region_id) << 32) | species_id;
+    }
+
+    static size_t entry_bytes(const Entry& entry) {
+        return sizeof(Entry) + entry.creatures.capacity() * sizeof(DormantCreature);
+    }
+
+    void remove(std::list<Entry>::iterator it);
+    void enforce_budget();
+
+    Config config_;
+    Stats stats_;
+
+    // 最近降级的条目在前
+    std::list<Entry> lru_;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> index_;
+    size_t bytes_ = 0;
+};
+
+} // namespace process
@@ -1,12 +1,14 @@
 #pragma once
 
 #include "core/Types.h"
+#include "core/Symbol.h"
+#include <type_traits>
 #include <variant>
-#include <string>
 
 // ============================================================
 // Effect 定义 - 世界状态变化的原子记录
 // 所有Process产生Effect，由EffectRecorder收集后统一应用
+// 名字类字段使用驻留的core::Symbol，Effect本身可平凡复制、定长
 // ============================================================
 
 namespace effect {
@@ -15,19 +17,19 @@ namespace effect {
 struct EntityCreated {
     EntityId entity_id;
     EntityType type;
-    std::string description;  // 可选描述
+    core::Symbol description;  // 可选描述
 };
 
 // Entity销毁
 struct EntityDestroyed {
     EntityId entity_id;
-    std::string reason;  // 销毁原因
+    core::Symbol reason;  // 销毁原因
 };
 
 // Resource变化（泛用）
 struct ResourceChanged {
     EntityId entity_id;
-    std::string resource_name;  // 如 "health", "hunger", "estimated_count"
+    core::Symbol resource_name;  // 如 sym::Health, sym::Hunger, sym::EstimatedCount
     float old_value;
     float new_value;
 };
@@ -43,7 +45,7 @@ struct Migration {
 // 死亡事件
 struct Death {
     EntityId entity_id;
-    std::string cause;       // "starvation", "old_age", "predation"
+    core::Symbol cause;       // sym::Starvation, sym::OldAge, sym::Predation
 };
 
 // 繁殖事件
@@ -56,7 +58,15 @@ struct Reproduction {
 // 组件添加（用于日志）
 struct ComponentAdded {
     EntityId entity_id;
-    std::string component_type;
+    core::Symbol component_type;
+};
+
+// Region/世界状态变化（不属于任何实体）
+struct RegionChanged {
+    uint32_t region_id;   // 0 = 世界范围（如生命周期模式）
+    core::Symbol field;   // sym::RegionMode, sym::CurrentFood, sym::LifecycleMode
+    float old_value;
+    float new_value;
 };
 
 // Effect变体
@@ -67,7 +77,10 @@ using Effect = std::variant<
     Migration,
     Death,
     Reproduction,
-    ComponentAdded
+    ComponentAdded,
+    RegionChanged
 >;
 
+static_assert(std::is_trivially_copyable_v<Effect>, "Effect must stay trivially copyable");
+
 } // namespace effect
@@ -0,0 +1,79 @@
+#include "EffectBus.h"
+#include <algorithm>
+
+namespace ecs {
+
+namespace {
+
+template<typename Channel>
+void remove_subscription(Channel& channel, uint32_t id) {
+    auto& listeners = channel.listeners;
+    listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                                   [id](const auto& l) { return l.id == id; }),
+                    listeners.end());
+
+    auto& queues = channel.queues;
+    for (auto& q : queues) {
+        if (q.id == id) {
+            q.queue->close();
+        }
+    }
+    queues.erase(std::remove_if(queues.begin(), queues.end(),
+                                [id](const auto& q) { return q.id == id; }),
+                 queues.end());
+}
+
+} // namespace
+
+EffectBus::~EffectBus() {
+    // 唤醒可能仍在等待的消费者
+    std::apply([](auto&... channel) {
+        auto close_all = [](auto& ch) {
+            for (auto& q : ch.queues) {
+                q.queue->close();
+            }
+        };
+        (close_all(channel), ...);
+    }, channels_);
+}
+
+void EffectBus::unsubscribe(SubscriptionId id) {
+    std::apply([id](auto&... channel) {
+        (remove_subscription(channel, id), ...);
+    }, channels_);
+}
+
+template<typename T>
+void EffectBus::dispatch(detail::EffectChannel<T>& channel, const EffectRecorder& recorder) {
+    if (channel.empty()) {
+        return;
+    }
+
+    // 序号单调递增：二分找到上次分发之后的第一条
+    const auto& items = recorder.each<T>();
+    const auto& seq = recorder.sequence<T>();
+    size_t begin = static_cast<size_t>(
+        std::lower_bound(seq.begin(), seq.end(), watermark_) - seq.begin());
+    if (begin == items.size()) {
+        return;
+    }
+
+    std::span<const T> batch(items.data() + begin, items.size() - begin);
+    for (const auto& listener : channel.listeners) {
+        listener.fn(batch);
+    }
+    for (const auto& q : channel.queues) {
+        q.queue->push(batch);
+    }
+    published_ += batch.size();
+}
+
+void EffectBus::publish(const EffectRecorder& recorder) {
+    std::apply([&](auto&... channel) {
+        (dispatch(channel, recorder), ...);
+    }, channels_);
+
+    watermark_ = recorder.get_next_sequence();
+}
+
+} // namespace ecs
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "EffectRecorder.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <vector>
+
+// ============================================================
+// Effect订阅总线
+// 监听者按Effect类型订阅，每个tick结束时收到该类型本tick新增Effect的连续span
+// （直接引用EffectRecorder的列缓冲，不复制）：
+//
+//   bus.subscribe<effect::Death>([](std::span<const effect::Death> deaths) { ... });
+//   bus.publish(recorder);   // tick结束时调用
+//
+// 慢消费者（其他线程、按自己节奏处理）用有界队列订阅，
+// 队列满时按策略丢弃最旧/最新的Effect，或阻塞发布方直到消费者取走。
+// 同一tick内按Effect变体中的类型顺序分发（EntityCreated → ... → RegionChanged），
+// 跨类型依赖顺序的监听者应以分发时的世界状态为准。
+// ============================================================
+
+namespace ecs {
+
+enum class OverflowPolicy {
+    DropOldest,  // 丢弃队列中最旧的Effect（保留最新状态）
+    DropNewest,  // 丢弃新到的Effect
+    Block,       // 发布方等待消费者腾出空间（消费者必须在其他线程）
+};
+
+// 有界Effect队列：发布方（模拟线程）写入，消费者可在任意线程取出
+template<typename T>
+class EffectQueue {
+public:
+    EffectQueue(size_t capacity, OverflowPolicy policy)
+        : capacity_(std::max<size_t>(capacity, 1)), policy_(policy) {}
+
+    // 发布方写入一批
+    void push(std::span<const T> batch) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < batch.size(); ) {
+            if (closed_) {
+                dropped_ += batch.size() - i;
+                return;
+            }
+
+            if (items_.size() < capacity_) {
+                size_t n = std::min(capacity_ - items_.size(), batch.size() - i);
+                items_.insert(items_.end(), batch.begin() + i, batch.begin() + i + n);
+                i += n;
+                continue;
+            }
+
+            switch (policy_) {
+            case OverflowPolicy::DropOldest:
+                items_.pop_front();
+                ++dropped_;
+                break;
+            case OverflowPolicy::DropNewest:
+                dropped_ += batch.size() - i;
+                return;
+            case OverflowPolicy::Block:
+                not_empty_.notify_one();
+                not_full_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+                break;
+            }
+        }
+        lock.unlock();
+        not_empty_.notify_one();
+    }
+
+    // 取出所有排队的Effect（追加到out），返回取出的数量
+    size_t drain(std::vector<T>& out) {
+        size_t n;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            n = items_.size();
+            out.insert(out.end(), items_.begin(), items_.end());
+            items_.clear();
+        }
+        not_full_.notify_all();
+        return n;
+    }
+
+    // 等待直到有Effect或队列关闭，然后取出全部
+    size_t wait_and_drain(std::vector<T>& out) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+        }
+        return drain(out);
+    }
+
+    // 关闭队列：唤醒阻塞的发布方/消费者，之后写入的Effect全部丢弃
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return items_.size();
+    }
+
+    uint64_t get_dropped() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dropped_;
+    }
+
+    size_t get_capacity() const { return capacity_; }
+    OverflowPolicy get_policy() const { return policy_; }
+
+private:
+    const size_t capacity_;
+    const OverflowPolicy policy_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<T> items_;
+    uint64_t dropped_ = 0;
+    bool closed_ = false;
+};
+
+namespace detail {
+
+template<typename T>
+struct EffectChannel {
+    struct Listener {
+        uint32_t id;
+        std::function<void(std::span<const T>)> fn;
+    };
+    struct Queue {
+        uint32_t id;
+        std::shared_ptr<EffectQueue<T>> queue;
+    };
+
+    std::vector<Listener> listeners;
+    std::vector<Queue> queues;
+
+    bool empty() const { return listeners.empty() && queues.empty(); }
+};
+
+template<typename V>
+struct EffectChannels;
+
+template<typename... Ts>
+struct EffectChannels<std::variant<Ts...>> {
+    using type = std::tuple<EffectChannel<Ts>...>;
+};
+
+} // namespace detail
+
+class EffectBus {
+public:
+    using SubscriptionId = uint32_t;
+
+    EffectBus() = default;
+    ~EffectBus();
+
+    EffectBus(const EffectBus&) = delete;
+    EffectBus& operator=(const EffectBus&) = delete;
+
+    // 同步监听：publish时在模拟线程直接调用（span只在回调期间有效）
+    template<typename T, typename F>
+    SubscriptionId subscribe(F&& listener) {
+        static_assert(is_effect_v<T>, "T must be an effect type");
+        SubscriptionId id = next_id_++;
+        channel<T>().listeners.push_back({id, std::forward<F>(listener)});
+        return id;
+    }
+
+    // 队列订阅：publish时写入有界队列，消费者自行取出
+    template<typename T>
+    std::shared_ptr<EffectQueue<T>> subscribe_queue(size_t capacity, OverflowPolicy policy,
+                                                    SubscriptionId* out_id = nullptr) {
+        static_assert(is_effect_v<T>, "T must be an effect type");
+        SubscriptionId id = next_id_++;
+        auto queue = std::make_shared<EffectQueue<T>>(capacity, policy);
+        channel<T>().queues.push_back({id, queue});
+        if (out_id) {
+            *out_id = id;
+        }
+        return queue;
+    }
+
+    // 取消订阅（队列订阅会被关闭）
+    void unsubscribe(SubscriptionId id);
+
+    // tick结束时分发recorder中上次publish之后新增的Effect
+    // （recorder可以跨多个tick才clear，已分发的部分不会重复分发）
+    void publish(const EffectRecorder& recorder);
+
+    uint64_t get_published() const { return published_; }
+
+private:
+    using Channels = detail::EffectChannels<effect::Effect>::type;
+
+    template<typename T>
+    detail::EffectChannel<T>& channel() {
+        return std::get<detail::EffectChannel<T>>(channels_);
+    }
+
+    template<typename T>
+    void dispatch(detail::EffectChannel<T>& channel, const EffectRecorder& recorder);
+
+    Channels channels_;
+    SubscriptionId next_id_ = 1;
+    uint64_t watermark_ = 0;   // 已分发的最大序号 + 1
+    uint64_t published_ = 0;
+};
+
+} // namespace ecs
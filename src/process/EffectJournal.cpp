@@ -0,0 +1,562 @@
+#include "EffectJournal.h"
+#include <array>
+#include <cstring>
+#include <iostream>
+
+namespace ecs {
+
+namespace {
+
+constexpr uint8_t kFileMagic[4] = {'G', 'W', 'E', 'J'};
+constexpr size_t kFileHeaderSize = 8;
+constexpr size_t kFrameHeaderSize = 8;
+constexpr uint32_t kMaxFrameSize = 64u << 20;  // 单帧负载上限（损坏的长度字段不触发巨量分配）
+
+// ========== 编码 ==========
+
+void put_u8(std::vector<uint8_t>& out, uint8_t v) {
+    out.push_back(v);
+}
+
+void put_u32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+}
+
+void put_f32(std::vector<uint8_t>& out, float v) {
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    put_u32(out, bits);
+}
+
+void put_f64(std::vector<uint8_t>& out, double v) {
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    put_u32(out, static_cast<uint32_t>(bits));
+    put_u32(out, static_cast<uint32_t>(bits >> 32));
+}
+
+void put_varint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+uint64_t zigzag(int64_t v) {
+    return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+int64_t unzigzag(uint64_t v) {
+    return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+// ========== 解码 ==========
+
+class ByteReader {
+public:
+    ByteReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    bool u8(uint8_t& v) {
+        if (pos_ >= size_) return false;
+        v = data_[pos_++];
+        return true;
+    }
+
+    bool u32(uint32_t& v) {
+        if (size_ - pos_ < 4) return false;
+        v = 0;
+        for (int i = 0; i < 4; ++i) {
+            v |= static_cast<uint32_t>(data_[pos_++]) << (8 * i);
+        }
+        return true;
+    }
+
+    bool f32(float& v) {
+        uint32_t bits;
+        if (!u32(bits)) return false;
+        std::memcpy(&v, &bits, sizeof(v));
+        return true;
+    }
+
+    bool f64(double& v) {
+        uint32_t lo, hi;
+        if (!u32(lo) || !u32(hi)) return false;
+        uint64_t bits = (static_cast<uint64_t>(hi) << 32) | lo;
+        std::memcpy(&v, &bits, sizeof(v));
+        return true;
+    }
+
+    bool varint(uint64_t& v) {
+        v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte;
+            if (!u8(byte)) return false;
+            v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+
+    bool varint32(uint32_t& v) {
+        uint64_t wide;
+        if (!varint(wide) || wide > UINT32_MAX) return false;
+        v = static_cast<uint32_t>(wide);
+        return true;
+    }
+
+    bool bytes(std::string& out, size_t n) {
+        if (size_ - pos_ < n) return false;
+        out.assign(reinterpret_cast<const char*>(data_ + pos_), n);
+        pos_ += n;
+        return true;
+    }
+
+    bool done() const { return pos_ == size_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+std::array<uint32_t, 256> make_crc_table() {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        table[i] = c;
+    }
+    return table;
+}
+
+} // namespace
+
+uint32_t crc32(const uint8_t* data, size_t size) {
+    static const std::array<uint32_t, 256> table = make_crc_table();
+
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        c = table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+// ========== EffectJournalWriter ==========
+
+EffectJournalWriter::~EffectJournalWriter() {
+    close();
+}
+
+core::ErrorCode EffectJournalWriter::open(const std::string& path) {
+    close();
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        #ifndef NDEBUG
+        std::cerr << "Error: Failed to open effect journal: " << path << std::endl;
+        #endif
+        return core::ErrorCode::IO_ERROR;
+    }
+
+    std::vector<uint8_t> header(kFileMagic, kFileMagic + 4);
+    header.push_back(static_cast<uint8_t>(kJournalVersion));
+    header.push_back(static_cast<uint8_t>(kJournalVersion >> 8));
+    header.push_back(0);
+    header.push_back(0);
+    std::fwrite(header.data(), 1, header.size(), file_);
+
+    symbol_written_.clear();
+    last_entity_ = 0;
+    stopping_ = false;
+    frames_queued_ = 0;
+    frames_written_ = 0;
+    bytes_written_ = header.size();
+
+    writer_ = std::thread(&EffectJournalWriter::writer_loop, this);
+    return core::ErrorCode::OK;
+}
+
+void EffectJournalWriter::close() {
+    if (!file_) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    writer_.join();
+
+    std::fclose(file_);
+    file_ = nullptr;
+}
+
+void EffectJournalWriter::encode_symbol(core::Symbol symbol) {
+    if (symbol.id >= symbol_written_.size()) {
+        symbol_written_.resize(symbol.id + 1, 0);
+    }
+    if (!symbol_written_[symbol.id]) {
+        symbol_written_[symbol.id] = 1;
+        std::string_view name = core::symbol_name(symbol);
+        put_varint(new_symbols_, symbol.id);
+        put_varint(new_symbols_, name.size());
+        new_symbols_.insert(new_symbols_.end(), name.begin(), name.end());
+        ++new_symbol_count_;
+    }
+    put_varint(body_, symbol.id);
+}
+
+template<typename T>
+void EffectJournalWriter::encode_effect(const T& e) {
+    EntityId entity;
+    if constexpr (std::is_same_v<T, effect::Reproduction>) {
+        entity = e.parent_id;
+    } else if constexpr (std::is_same_v<T, effect::RegionChanged>) {
+        entity = last_entity_;  // 不属于实体，增量为0
+    } else {
+        entity = e.entity_id;
+    }
+
+    put_u8(body_, static_cast<uint8_t>(effect::Effect(std::in_place_type<T>).index()));
+    put_varint(body_, zigzag(static_cast<int64_t>(entity) - static_cast<int64_t>(last_entity_)));
+    last_entity_ = entity;
+
+    if constexpr (std::is_same_v<T, effect::EntityCreated>) {
+        put_u8(body_, static_cast<uint8_t>(e.type));
+        encode_symbol(e.description);
+    } else if constexpr (std::is_same_v<T, effect::EntityDestroyed>) {
+        encode_symbol(e.reason);
+    } else if constexpr (std::is_same_v<T, effect::ResourceChanged>) {
+        encode_symbol(e.resource_name);
+        put_f32(body_, e.old_value);
+        put_f32(body_, e.new_value);
+    } else if constexpr (std::is_same_v<T, effect::Migration>) {
+        put_varint(body_, e.from_region);
+        put_varint(body_, e.to_region);
+        put_f32(body_, e.migrant_count);
+    } else if constexpr (std::is_same_v<T, effect::Death>) {
+        encode_symbol(e.cause);
+    } else if constexpr (std::is_same_v<T, effect::Reproduction>) {
+        put_varint(body_, zigzag(static_cast<int64_t>(e.child_id) - static_cast<int64_t>(e.parent_id)));
+        put_varint(body_, e.species_id);
+    } else if constexpr (std::is_same_v<T, effect::ComponentAdded>) {
+        encode_symbol(e.component_type);
+    } else if constexpr (std::is_same_v<T, effect::RegionChanged>) {
+        put_varint(body_, e.region_id);
+        encode_symbol(e.field);
+        put_f32(body_, e.old_value);
+        put_f32(body_, e.new_value);
+    }
+}
+
+void EffectJournalWriter::append_tick(uint64_t tick, float time, double lifecycle_clock,
+                                      const EffectRecorder& recorder) {
+    if (!file_) {
+        return;
+    }
+
+    // 1. 编码Effect（同时收集首次出现的符号）
+    body_.clear();
+    new_symbols_.clear();
+    new_symbol_count_ = 0;
+    recorder.for_each_ordered([this](const auto& e) { encode_effect(e); });
+
+    // 2. 组装负载
+    std::vector<uint8_t> payload;
+    payload.reserve(body_.size() + new_symbols_.size() + 16);
+    put_varint(payload, tick);
+    put_f32(payload, time);
+    put_f64(payload, lifecycle_clock);
+    put_varint(payload, new_symbol_count_);
+    payload.insert(payload.end(), new_symbols_.begin(), new_symbols_.end());
+    put_varint(payload, recorder.size());
+    payload.insert(payload.end(), body_.begin(), body_.end());
+
+    // 3. 帧头 + 负载
+    frame_.clear();
+    put_u32(frame_, static_cast<uint32_t>(payload.size()));
+    put_u32(frame_, crc32(payload.data(), payload.size()));
+    frame_.insert(frame_.end(), payload.begin(), payload.end());
+
+    // 4. 交给写入线程（只在追加时持锁）
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queued_.insert(queued_.end(), frame_.begin(), frame_.end());
+        ++frames_queued_;
+    }
+    wake_.notify_one();
+}
+
+void EffectJournalWriter::writer_loop() {
+    while (true) {
+        uint64_t frames = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stopping_ || !queued_.empty(); });
+            if (queued_.empty() && stopping_) {
+                return;
+            }
+            writing_.swap(queued_);
+            frames = frames_queued_;
+        }
+
+        // 不持锁写盘
+        std::fwrite(writing_.data(), 1, writing_.size(), file_);
+        std::fflush(file_);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            bytes_written_ += writing_.size();
+            frames_written_ = frames;
+        }
+        writing_.clear();
+    }
+}
+
+uint64_t EffectJournalWriter::get_frames_written() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frames_written_;
+}
+
+uint64_t EffectJournalWriter::get_bytes_written() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_written_;
+}
+
+size_t EffectJournalWriter::get_pending_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queued_.size();
+}
+
+// ========== EffectJournalReader ==========
+
+EffectJournalReader::~EffectJournalReader() {
+    close();
+}
+
+core::ErrorCode EffectJournalReader::open(const std::string& path) {
+    close();
+
+    file_ = std::fopen(path.c_str(), "rb");
+    if (!file_) {
+        return core::ErrorCode::IO_ERROR;
+    }
+
+    uint8_t header[kFileHeaderSize];
+    if (std::fread(header, 1, kFileHeaderSize, file_) != kFileHeaderSize ||
+        std::memcmp(header, kFileMagic, 4) != 0) {
+        close();
+        return core::ErrorCode::CORRUPT_DATA;
+    }
+
+    uint16_t version = static_cast<uint16_t>(header[4] | (header[5] << 8));
+    if (version != kJournalVersion) {
+        close();
+        return core::ErrorCode::CORRUPT_DATA;
+    }
+
+    // 记录文件长度，读帧时校验负载长度不超过剩余字节
+    if (std::fseek(file_, 0, SEEK_END) != 0 || (file_size_ = std::ftell(file_)) < 0 ||
+        std::fseek(file_, static_cast<long>(kFileHeaderSize), SEEK_SET) != 0) {
+        close();
+        return core::ErrorCode::IO_ERROR;
+    }
+
+    symbols_.clear();
+    last_entity_ = 0;
+    frames_read_ = 0;
+    return core::ErrorCode::OK;
+}
+
+void EffectJournalReader::close() {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+core::Result<bool> EffectJournalReader::next_frame(JournalFrame& out) {
+    if (!file_) {
+        return core::Result<bool>::Err(core::ErrorCode::NOT_INITIALIZED);
+    }
+
+    uint8_t header[kFrameHeaderSize];
+    size_t got = std::fread(header, 1, kFrameHeaderSize, file_);
+    if (got == 0) {
+        return core::Result<bool>::Ok(false);
+    }
+    if (got != kFrameHeaderSize) {
+        return core::Result<bool>::Err(core::ErrorCode::CORRUPT_DATA);
+    }
+
+    ByteReader head(header, kFrameHeaderSize);
+    uint32_t size = 0;
+    uint32_t crc = 0;
+    head.u32(size);
+    head.u32(crc);
+
+    long position = std::ftell(file_);
+    if (size > kMaxFrameSize || position < 0 || static_cast<long>(size) > file_size_ - position) {
+        return core::Result<bool>::Err(core::ErrorCode::CORRUPT_DATA);
+    }
+
+    payload_.resize(size);
+    if (std::fread(payload_.data(), 1, size, file_) != size ||
+        crc32(payload_.data(), payload_.size()) != crc ||
+        !decode_payload(payload_, out)) {
+        return core::Result<bool>::Err(core::ErrorCode::CORRUPT_DATA);
+    }
+
+    ++frames_read_;
+    return core::Result<bool>::Ok(true);
+}
+
+bool EffectJournalReader::decode_payload(const std::vector<uint8_t>& payload, JournalFrame& out) {
+    ByteReader in(payload.data(), payload.size());
+    out.effects.clear();
+
+    uint32_t symbol_count = 0;
+    if (!in.varint(out.tick) || !in.f32(out.time) || !in.f64(out.lifecycle_clock) ||
+        !in.varint32(symbol_count)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < symbol_count; ++i) {
+        uint32_t id = 0;
+        uint32_t length = 0;
+        std::string name;
+        if (!in.varint32(id) || !in.varint32(length) || !in.bytes(name, length)) {
+            return false;
+        }
+        symbols_[id] = core::intern(name);
+    }
+
+    auto symbol = [&](core::Symbol& s) {
+        uint32_t id = 0;
+        if (!in.varint32(id)) return false;
+        auto it = symbols_.find(id);
+        if (it == symbols_.end()) return false;
+        s = it->second;
+        return true;
+    };
+
+    uint64_t count = 0;
+    if (!in.varint(count)) {
+        return false;
+    }
+    out.effects.reserve(count);
+
+    // 实体增量跨帧累计（与写入端一致）
+    for (uint64_t i = 0; i < count; ++i) {
+        uint8_t kind = 0;
+        uint64_t delta = 0;
+        if (!in.u8(kind) || !in.varint(delta)) {
+            return false;
+        }
+        EntityId entity = static_cast<EntityId>(static_cast<int64_t>(last_entity_) + unzigzag(delta));
+        last_entity_ = entity;
+
+        bool ok = true;
+        switch (kind) {
+        case 0: {
+            effect::EntityCreated e{entity, EntityType::Creature, core::sym::None};
+            uint8_t type = 0;
+            ok = in.u8(type) && symbol(e.description);
+            e.type = static_cast<EntityType>(type);
+            out.effects.emplace_back(e);
+            break;
+        }
+        case 1: {
+            effect::EntityDestroyed e{entity, core::sym::None};
+            ok = symbol(e.reason);
+            out.effects.emplace_back(e);
+            break;
+        }
+        case 2: {
+            effect::ResourceChanged e{entity, core::sym::None, 0.0f, 0.0f};
+            ok = symbol(e.resource_name) && in.f32(e.old_value) && in.f32(e.new_value);
+            out.effects.emplace_back(e);
+            break;
+        }
+        case 3: {
+            effect::Migration e{entity, 0, 0, 0.0f};
+            ok = in.varint32(e.from_region) && in.varint32(e.to_region) && in.f32(e.migrant_count);
+            out.effects.emplace_back(e);
+            break;
+        }
+        case 4: {
+            effect::Death e{entity, core::sym::None};
+            ok = symbol(e.cause);
+            out.effects.emplace_back(e);
+            break;
+        }
+        case 5: {
+            effect::Reproduction e{entity, 0, 0};
+            uint64_t child_delta = 0;
+            ok = in.varint(child_delta) && in.varint32(e.species_id);
+            e.child_id = static_cast<EntityId>(static_cast<int64_t>(entity) + unzigzag(child_delta));
+            out.effects.emplace_back(e);
+            break;
+        }
+        case 6: {
+            effect::ComponentAdded e{entity, core::sym::None};
+            ok = symbol(e.component_type);
+            out.effects.emplace_back(e);
+            break;
+        }
+        case 7: {
+            effect::RegionChanged e{0, core::sym::None, 0.0f, 0.0f};
+            ok = in.varint32(e.region_id) && symbol(e.field) && in.f32(e.old_value) && in.f32(e.new_value);
+            out.effects.emplace_back(e);
+            break;
+        }
+        default:
+            ok = false;
+        }
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return in.done();
+}
+
+core::Result<uint64_t> decode_journal_to_text(const std::string& journal_path, std::ostream& out) {
+    EffectJournalReader reader;
+    core::ErrorCode open_result = reader.open(journal_path);
+    if (open_result != core::ErrorCode::OK) {
+        return core::Result<uint64_t>::Err(open_result);
+    }
+
+    uint64_t total = 0;
+    JournalFrame frame;
+    while (true) {
+        auto result = reader.next_frame(frame);
+        if (result.is_err()) {
+            #ifndef NDEBUG
+            std::cerr << "Error: Corrupt journal frame after " << reader.get_frames_read()
+                      << " frames" << std::endl;
+            #endif
+            return core::Result<uint64_t>::Err(result.error());
+        }
+        if (!result.value()) {
+            break;
+        }
+
+        for (const auto& e : frame.effects) {
+            out << EffectRecorder::effect_to_string(e) << '\n';
+        }
+        total += frame.effects.size();
+    }
+
+    return core::Result<uint64_t>::Ok(std::move(total));
+}
+
+} // namespace ecs
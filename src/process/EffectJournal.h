@@ -0,0 +1,135 @@
+#pragma once
+
+#include "EffectRecorder.h"
+#include "core/Result.h"
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================
+// Effect日志（二进制、只追加）
+//
+// 文件 = 文件头 + 若干帧，每个tick一帧：
+//   文件头: "GWEJ" | u16 版本 | u16 保留
+//   帧:     u32 负载长度 | u32 CRC32(负载) | 负载
+//   负载:   varint tick | f32 时间 | f64 生命周期时钟
+//           varint 新符号数 | { varint 符号ID | varint 长度 | 名字 }   （首次出现的符号）
+//           varint Effect数 | { u8 类型 | zigzag varint 实体ID增量 | 字段... }
+// 实体ID按与上一条Effect的差值编码（RegionChanged不属于实体，增量恒为0）；
+// 符号按写入端的ID编码，读取端重新驻留。
+//
+// 写入端：模拟线程只负责编码并把帧追加到队列（只在交换缓冲时持锁），
+// 后台线程把双缓冲中的另一半写入磁盘，模拟线程不会等待磁盘。
+// ============================================================
+
+namespace ecs {
+
+constexpr uint16_t kJournalVersion = 2;
+
+// CRC-32（IEEE 802.3）
+uint32_t crc32(const uint8_t* data, size_t size);
+
+class EffectJournalWriter {
+public:
+    EffectJournalWriter() = default;
+    ~EffectJournalWriter();
+
+    EffectJournalWriter(const EffectJournalWriter&) = delete;
+    EffectJournalWriter& operator=(const EffectJournalWriter&) = delete;
+
+    // 创建（覆盖）日志文件并启动写入线程
+    core::ErrorCode open(const std::string& path);
+
+    // 编码一个tick的所有Effect（按记录顺序）并交给写入线程
+    // lifecycle_clock 为事件驱动生命周期的时钟（SimulationState::lifecycle_clock）
+    void append_tick(uint64_t tick, float time, double lifecycle_clock, const EffectRecorder& recorder);
+
+    // 等待队列写完并关闭文件
+    void close();
+
+    bool is_open() const { return file_ != nullptr; }
+
+    uint64_t get_frames_written() const;
+    uint64_t get_bytes_written() const;
+    size_t get_pending_bytes() const;
+
+private:
+    void writer_loop();
+
+    template<typename T>
+    void encode_effect(const T& e);
+
+    void encode_symbol(core::Symbol symbol);
+
+    std::FILE* file_ = nullptr;
+    std::thread writer_;
+
+    // 编码状态（只在模拟线程访问）
+    std::vector<uint8_t> frame_;
+    std::vector<uint8_t> body_;
+    std::vector<uint8_t> new_symbols_;
+    uint32_t new_symbol_count_ = 0;
+    std::vector<uint8_t> symbol_written_;  // 按符号ID标记是否已写入定义
+    EntityId last_entity_ = 0;
+
+    // 双缓冲：模拟线程追加到queued_，写入线程交换后写盘
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<uint8_t> queued_;
+    std::vector<uint8_t> writing_;
+    bool stopping_ = false;
+    uint64_t frames_queued_ = 0;
+    uint64_t frames_written_ = 0;
+    uint64_t bytes_written_ = 0;
+};
+
+// 解码后的一帧
+struct JournalFrame {
+    uint64_t tick = 0;
+    float time = 0.0f;
+    double lifecycle_clock = 0.0;
+    std::vector<effect::Effect> effects;
+};
+
+class EffectJournalReader {
+public:
+    EffectJournalReader() = default;
+    ~EffectJournalReader();
+
+    EffectJournalReader(const EffectJournalReader&) = delete;
+    EffectJournalReader& operator=(const EffectJournalReader&) = delete;
+
+    // 打开日志并校验文件头
+    core::ErrorCode open(const std::string& path);
+
+    // 读取下一帧：Ok(true) 读到一帧，Ok(false) 正常结束，
+    // Err(CORRUPT_DATA) 帧不完整、长度超出文件剩余字节（或单帧上限）或CRC不匹配
+    core::Result<bool> next_frame(JournalFrame& out);
+
+    void close();
+
+    // 已读取的帧数（出错时用于定位）
+    uint64_t get_frames_read() const { return frames_read_; }
+
+private:
+    bool decode_payload(const std::vector<uint8_t>& payload, JournalFrame& out);
+
+    std::FILE* file_ = nullptr;
+    long file_size_ = 0;
+    std::vector<uint8_t> payload_;
+    std::unordered_map<uint32_t, core::Symbol> symbols_;  // 日志中的符号ID → 本进程符号
+    EntityId last_entity_ = 0;
+    uint64_t frames_read_ = 0;
+};
+
+// 把日志解码为与EffectRecorder::log_to_file相同的文本格式
+// 返回写出的Effect数，出错时返回错误码
+core::Result<uint64_t> decode_journal_to_text(const std::string& journal_path, std::ostream& out);
+
+} // namespace ecs
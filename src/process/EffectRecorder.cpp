@@ -1,14 +1,157 @@
 #include "EffectRecorder.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
 namespace ecs {
 
-void EffectRecorder::record(effect::Effect&& e) {
-    effects_.push_back(std::move(e));
+void EffectRecorder::record(const effect::Effect& e) {
+    std::visit([this](const auto& eff) { record(eff); }, e);
 }
 
-std::string EffectRecorder::effect_to_string(const effect::Effect& e) const {
+void EffectRecorder::clear() {
+    std::apply([](auto&... stream) {
+        ((stream.items.clear(), stream.seq.clear()), ...);
+    }, streams_);
+}
+
+// ========== ResourceChanged合并 ==========
+
+void EffectRecorder::set_coalescing(const CoalesceConfig& config) {
+    flush_coalesced();
+
+    coalesce_ = config;
+    coalesce_.window_ticks = std::max<uint32_t>(coalesce_.window_ticks, 1);
+    buckets_.assign(coalesce_.window_ticks, {});
+}
+
+float EffectRecorder::epsilon_for(core::Symbol resource) const {
+    auto it = coalesce_.epsilon.find(resource.id);
+    return it != coalesce_.epsilon.end() ? it->second : coalesce_.default_epsilon;
+}
+
+bool EffectRecorder::emit_or_drop(EntityId entity, const PendingChange& change) {
+    float delta = std::abs(change.new_value - change.old_value);
+    if (delta == 0.0f || delta < epsilon_for(change.resource)) {
+        return false;
+    }
+
+    append(effect::ResourceChanged{entity, change.resource, change.old_value, change.new_value});
+    ++coalesce_stats_.emitted;
+    return true;
+}
+
+void EffectRecorder::coalesce(const effect::ResourceChanged& e) {
+    ++coalesce_stats_.received;
+
+    auto& changes = pending_[e.entity_id];
+    for (auto& change : changes) {
+        if (change.resource == e.resource_name) {
+            change.new_value = e.new_value;
+            return;
+        }
+    }
+
+    changes.push_back({e.resource_name, e.old_value, e.new_value, tick_});
+    buckets_[tick_ % buckets_.size()].push_back({e.entity_id, e.resource_name});
+}
+
+void EffectRecorder::flush_entity(EntityId entity) {
+    auto it = pending_.find(entity);
+    if (it == pending_.end()) {
+        return;
+    }
+
+    // 桶中残留的键在到期时因找不到条目而跳过
+    for (const auto& change : it->second) {
+        if (!emit_or_drop(entity, change)) {
+            ++coalesce_stats_.dropped;
+        }
+    }
+    pending_.erase(it);
+}
+
+void EffectRecorder::flush_bucket(std::vector<PendingKey>& keys, uint64_t opened_tick, bool force) {
+    for (const auto& key : keys) {
+        auto it = pending_.find(key.entity);
+        if (it == pending_.end()) {
+            continue;
+        }
+
+        auto& changes = it->second;
+        auto change = std::find_if(changes.begin(), changes.end(), [&](const PendingChange& c) {
+            return c.resource == key.resource && c.opened_tick == opened_tick;
+        });
+        if (change == changes.end()) {
+            continue;
+        }
+
+        if (emit_or_drop(key.entity, *change)) {
+            changes.erase(change);
+        } else if (force) {
+            ++coalesce_stats_.dropped;
+            changes.erase(change);
+        } else {
+            // 累积变化仍小于epsilon：留到下一个窗口
+            change->opened_tick = tick_ + 1;
+            buckets_[(tick_ + 1) % buckets_.size()].push_back(key);
+        }
+
+        if (changes.empty()) {
+            pending_.erase(it);
+        }
+    }
+}
+
+void EffectRecorder::end_tick() {
+    if (!buckets_.empty()) {
+        // 在本tick结束时到期的是 tick_ - window + 1 打开的条目，与下一tick共用一个桶
+        const uint64_t window = buckets_.size();
+        auto& bucket = buckets_[(tick_ + 1) % window];
+        expiring_.swap(bucket);
+        bucket.clear();
+        if (tick_ + 1 >= window) {
+            flush_bucket(expiring_, tick_ + 1 - window, false);
+        }
+        expiring_.clear();
+    }
+    ++tick_;
+}
+
+void EffectRecorder::flush_coalesced() {
+    // 从最早打开的桶开始输出，保持确定的顺序
+    const uint64_t window = buckets_.size();
+    for (uint64_t k = 1; k <= window; ++k) {
+        uint64_t opened = tick_ + k;
+        if (opened < window) {
+            continue;
+        }
+        opened -= window;
+        expiring_.swap(buckets_[(tick_ + k) % window]);
+        buckets_[(tick_ + k) % window].clear();
+        flush_bucket(expiring_, opened, true);
+        expiring_.clear();
+    }
+    pending_.clear();
+}
+
+size_t EffectRecorder::pending_coalesced() const {
+    size_t total = 0;
+    for (const auto& [entity, changes] : pending_) {
+        total += changes.size();
+    }
+    return total;
+}
+
+size_t EffectRecorder::size() const {
+    return std::apply([](const auto&... stream) {
+        return (stream.items.size() + ... + size_t{0});
+    }, streams_);
+}
+
+std::string EffectRecorder::effect_to_string(const effect::Effect& e) {
     std::ostringstream oss;
 
     std::visit([&oss](const auto& eff) {
@@ -22,13 +165,13 @@ std::string EffectRecorder::effect_to_string(const effect::Effect& e) const {
                 case EntityType::Faction: oss << "Faction"; break;
                 case EntityType::Location: oss << "Location"; break;
             }
-            oss << ", desc=" << eff.description << "]";
+            oss << ", desc=" << core::symbol_name(eff.description) << "]";
         }
         else if constexpr (std::is_same_v<T, effect::EntityDestroyed>) {
-            oss << "EntityDestroyed[id=" << eff.entity_id << ", reason=" << eff.reason << "]";
+            oss << "EntityDestroyed[id=" << eff.entity_id << ", reason=" << core::symbol_name(eff.reason) << "]";
         }
         else if constexpr (std::is_same_v<T, effect::ResourceChanged>) {
-            oss << "ResourceChanged[id=" << eff.entity_id << ", " << eff.resource_name
+            oss << "ResourceChanged[id=" << eff.entity_id << ", " << core::symbol_name(eff.resource_name)
                 << ": " << eff.old_value << " -> " << eff.new_value << "]";
         }
         else if constexpr (std::is_same_v<T, effect::Migration>) {
@@ -36,14 +179,18 @@ std::string EffectRecorder::effect_to_string(const effect::Effect& e) const {
                 << " -> " << eff.to_region << ", count=" << eff.migrant_count << "]";
         }
         else if constexpr (std::is_same_v<T, effect::Death>) {
-            oss << "Death[id=" << eff.entity_id << ", cause=" << eff.cause << "]";
+            oss << "Death[id=" << eff.entity_id << ", cause=" << core::symbol_name(eff.cause) << "]";
         }
         else if constexpr (std::is_same_v<T, effect::Reproduction>) {
             oss << "Reproduction[parent=" << eff.parent_id << ", child=" << eff.child_id
                 << ", species=" << eff.species_id << "]";
         }
         else if constexpr (std::is_same_v<T, effect::ComponentAdded>) {
-            oss << "ComponentAdded[id=" << eff.entity_id << ", type=" << eff.component_type << "]";
+            oss << "ComponentAdded[id=" << eff.entity_id << ", type=" << core::symbol_name(eff.component_type) << "]";
+        }
+        else if constexpr (std::is_same_v<T, effect::RegionChanged>) {
+            oss << "RegionChanged[region=" << eff.region_id << ", " << core::symbol_name(eff.field)
+                << ": " << eff.old_value << " -> " << eff.new_value << "]";
         }
     }, e);
 
@@ -51,14 +198,15 @@ std::string EffectRecorder::effect_to_string(const effect::Effect& e) const {
 }
 
 void EffectRecorder::log_to_console() const {
-    if (effects_.empty()) {
+    size_t count = size();
+    if (count == 0) {
         return;
     }
 
-    std::cout << "=== Effects (" << effects_.size() << ") ===" << std::endl;
-    for (const auto& eff : effects_) {
+    std::cout << "=== Effects (" << count << ") ===" << std::endl;
+    for_each_ordered([](const auto& eff) {
         std::cout << "  " << effect_to_string(eff) << std::endl;
-    }
+    });
 }
 
 void EffectRecorder::log_to_file(const std::string& path) const {
@@ -68,9 +216,9 @@ void EffectRecorder::log_to_file(const std::string& path) const {
         return;
     }
 
-    for (const auto& eff : effects_) {
-        file << effect_to_string(eff) << std::endl;
-    }
+    for_each_ordered([&file](const auto& eff) {
+        file << effect_to_string(eff) << '\n';
+    });
 
     file.close();
 }
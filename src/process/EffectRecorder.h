@@ -1,37 +1,142 @@
 #pragma once
 
 #include "Effect.h"
-#include <vector>
+#include <cstdint>
+#include <limits>
 #include <string>
-#include <fstream>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 // ============================================================
 // Effect记录器 - 收集并记录所有状态变化
+// 按列存储：每种Effect一段连续的定型缓冲 + 平行的全局序号，
+// 只关心某一类Effect的消费者直接扫描对应的缓冲：
+//
+//   for (const auto& death : recorder.each<effect::Death>()) { ... }
+//
+// 需要原始顺序时用 for_each_ordered 按序号归并各缓冲。
+//
+// 可选的合并阶段（默认关闭）：同一 (实体, Resource) 在窗口内的连续
+// ResourceChanged 合并为一条（首个old → 最后的new），在窗口结束的 end_tick()
+// 输出；变化量小于该Resource的epsilon时继续累积，不输出。
+// 结构性Effect不受影响；实体Death/EntityDestroyed之前先输出它的待合并变化。
 // ============================================================
 
 namespace ecs {
 
+namespace detail {
+
+// 单类Effect的列：数据与序号分开存放，扫描数据时不读取序号
+template<typename T>
+struct EffectStream {
+    std::vector<T> items;
+    std::vector<uint64_t> seq;
+};
+
+template<typename V>
+struct EffectStreams;
+
+template<typename... Ts>
+struct EffectStreams<std::variant<Ts...>> {
+    using type = std::tuple<EffectStream<Ts>...>;
+};
+
+template<typename T, typename V>
+struct IsEffectAlternative;
+
+template<typename T, typename... Ts>
+struct IsEffectAlternative<T, std::variant<Ts...>>
+    : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {};
+
+} // namespace detail
+
+template<typename T>
+inline constexpr bool is_effect_v = detail::IsEffectAlternative<std::decay_t<T>, effect::Effect>::value;
+
+// ResourceChanged合并策略
+struct CoalesceConfig {
+    bool enabled = false;
+    uint32_t window_ticks = 1;                   // 合并窗口（tick数，至少1）
+    float default_epsilon = 0.0f;                // 未单独配置的Resource
+    std::unordered_map<uint32_t, float> epsilon; // Resource符号ID → 最小输出变化量
+};
+
+struct CoalesceStats {
+    uint64_t received = 0;  // 进入合并阶段的ResourceChanged
+    uint64_t emitted = 0;   // 合并后输出的ResourceChanged
+    uint64_t dropped = 0;   // 因小于epsilon而丢弃的待合并变化（实体销毁或强制输出时）
+
+    // 被合并/丢弃的比例（0.9 表示只输出了 10%）
+    double reduction_ratio() const {
+        return received > 0 ? 1.0 - static_cast<double>(emitted) / static_cast<double>(received) : 0.0;
+    }
+};
+
 class EffectRecorder {
 public:
     EffectRecorder() = default;
 
-    // 记录单个Effect
-    void record(effect::Effect&& e);
+    // 记录单个Effect（按具体类型直接写入对应的列）
+    template<typename T, typename = std::enable_if_t<is_effect_v<T>>>
+    void record(const T& e) {
+        using E = std::decay_t<T>;
+        if constexpr (std::is_same_v<E, effect::ResourceChanged>) {
+            if (coalesce_.enabled) {
+                coalesce(e);
+                return;
+            }
+        } else if constexpr (std::is_same_v<E, effect::Death> || std::is_same_v<E, effect::EntityDestroyed>) {
+            if (!pending_.empty()) {
+                flush_entity(e.entity_id);
+            }
+        }
+        append(e);
+    }
+
+    // 记录变体形式的Effect
+    void record(const effect::Effect& e);
 
-    // 获取所有Effect
-    const std::vector<effect::Effect>& get_effects() const {
-        return effects_;
+    // 某一类Effect的连续缓冲（按记录顺序）
+    template<typename T>
+    const std::vector<T>& each() const {
+        return std::get<detail::EffectStream<T>>(streams_).items;
     }
 
-    // 清空缓冲区
-    void clear() {
-        effects_.clear();
+    // 与each<T>()一一对应的全局序号
+    template<typename T>
+    const std::vector<uint64_t>& sequence() const {
+        return std::get<detail::EffectStream<T>>(streams_).seq;
     }
 
+    // 按全局序号归并所有缓冲，f 以具体类型的 const T& 调用
+    template<typename F>
+    void for_each_ordered(F&& f) const;
+
+    // 清空缓冲区（序号继续递增；待合并的变化保留到窗口结束）
+    void clear();
+
+    // 设置合并策略（会先输出所有待合并的变化）
+    void set_coalescing(const CoalesceConfig& config);
+    const CoalesceConfig& get_coalescing() const { return coalesce_; }
+
+    // tick结束：输出窗口已满的合并结果（每步调用一次，在读取本步Effect之前）
+    void end_tick();
+
+    // 立即输出所有待合并的变化（模拟结束/切换策略时）
+    void flush_coalesced();
+
+    const CoalesceStats& get_coalesce_stats() const { return coalesce_stats_; }
+    size_t pending_coalesced() const;
+
     // 获取Effect数量
-    size_t size() const {
-        return effects_.size();
-    }
+    size_t size() const;
+
+    bool empty() const { return size() == 0; }
+
+    // 下一个Effect的序号（自创建以来记录的总数）
+    uint64_t get_next_sequence() const { return next_seq_; }
 
     // 格式化输出到控制台
     void log_to_console() const;
@@ -39,11 +144,76 @@ public:
     // 输出到日志文件
     void log_to_file(const std::string& path) const;
 
+    // 将Effect转换为字符串
+    static std::string effect_to_string(const effect::Effect& e);
+
 private:
-    std::vector<effect::Effect> effects_;
+    using Streams = detail::EffectStreams<effect::Effect>::type;
 
-    // 将Effect转换为字符串
-    std::string effect_to_string(const effect::Effect& e) const;
+    template<typename T>
+    void append(const T& e) {
+        auto& stream = std::get<detail::EffectStream<T>>(streams_);
+        stream.items.push_back(e);
+        stream.seq.push_back(next_seq_++);
+    }
+
+    // 待合并的变化（每个实体通常只有Age/Hunger等少数几项）
+    struct PendingChange {
+        core::Symbol resource;
+        float old_value;
+        float new_value;
+        uint64_t opened_tick;
+    };
+
+    struct PendingKey {
+        EntityId entity;
+        core::Symbol resource;
+    };
+
+    void coalesce(const effect::ResourceChanged& e);
+    void flush_entity(EntityId entity);
+    void flush_bucket(std::vector<PendingKey>& keys, uint64_t opened_tick, bool force);
+    float epsilon_for(core::Symbol resource) const;
+    bool emit_or_drop(EntityId entity, const PendingChange& change);
+
+    Streams streams_;
+    uint64_t next_seq_ = 0;
+
+    CoalesceConfig coalesce_;
+    CoalesceStats coalesce_stats_;
+    uint64_t tick_ = 0;
+    std::unordered_map<EntityId, std::vector<PendingChange>> pending_;
+    std::vector<std::vector<PendingKey>> buckets_;  // 按打开tick分桶的环形缓冲（window_ticks个）
+    std::vector<PendingKey> expiring_;              // 复用的到期键缓冲
 };
 
+template<typename F>
+void EffectRecorder::for_each_ordered(F&& f) const {
+    constexpr size_t kStreams = std::tuple_size_v<Streams>;
+    size_t cursor[kStreams] = {};
+
+    while (true) {
+        // 在各缓冲的队首中找序号最小者
+        size_t best = kStreams;
+        uint64_t best_seq = std::numeric_limits<uint64_t>::max();
+
+        size_t index = 0;
+        std::apply([&](const auto&... stream) {
+            ((cursor[index] < stream.seq.size() && stream.seq[cursor[index]] < best_seq
+                  ? (best = index, best_seq = stream.seq[cursor[index]], ++index)
+                  : ++index), ...);
+        }, streams_);
+
+        if (best == kStreams) {
+            return;
+        }
+
+        index = 0;
+        std::apply([&](const auto&... stream) {
+            ((index++ == best ? (f(stream.items[cursor[best]]), 0) : 0), ...);
+        }, streams_);
+        ++cursor[best];
+    }
+}
+
 } // namespace ecs
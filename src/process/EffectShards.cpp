@@ -0,0 +1,70 @@
+#include "EffectShards.h"
+#include <algorithm>
+#include <numeric>
+
+namespace ecs {
+
+EntityId EffectShard::effect_entity(const effect::Effect& e) {
+    return std::visit([](const auto& eff) -> EntityId {
+        using T = std::decay_t<decltype(eff)>;
+        if constexpr (std::is_same_v<T, effect::Reproduction>) {
+            return eff.parent_id;
+        } else if constexpr (std::is_same_v<T, effect::RegionChanged>) {
+            return 0;
+        } else {
+            return eff.entity_id;
+        }
+    }, e);
+}
+
+void EffectShard::drain_into(EffectRecorder& recorder) {
+    // 组件池通常按创建顺序排列，已有序时直接写入
+    if (std::is_sorted(entities_.begin(), entities_.end())) {
+        for (const auto& e : effects_) {
+            recorder.record(e);
+        }
+        clear();
+        return;
+    }
+
+    order_.resize(effects_.size());
+    std::iota(order_.begin(), order_.end(), 0u);
+    std::stable_sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) {
+        return entities_[a] < entities_[b];
+    });
+
+    for (uint32_t i : order_) {
+        recorder.record(effects_[i]);
+    }
+    clear();
+}
+
+std::vector<EffectShard>& EffectShardSet::prepare(uint32_t system, size_t chunk_count) {
+    auto& shards = systems_[system];
+    if (shards.size() < chunk_count) {
+        shards.resize(chunk_count);
+    }
+    return shards;
+}
+
+void EffectShardSet::merge_into(EffectRecorder& recorder) {
+    for (auto& [system, shards] : systems_) {
+        for (auto& shard : shards) {
+            if (!shard.empty()) {
+                shard.drain_into(recorder);
+            }
+        }
+    }
+}
+
+size_t EffectShardSet::pending() const {
+    size_t total = 0;
+    for (const auto& [system, shards] : systems_) {
+        for (const auto& shard : shards) {
+            total += shard.size();
+        }
+    }
+    return total;
+}
+
+} // namespace ecs
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "EffectRecorder.h"
+#include <cstdint>
+#include <map>
+#include <vector>
+
+// ============================================================
+// 分片Effect记录（并行Process用）
+// 并行执行时每个工作块（chunk）写入自己的分片，互不竞争；
+// 在tick屏障处按 (system, chunk, entity, 分片内顺序) 归并进EffectRecorder。
+// chunk 的划分只取决于数据量而与线程数无关，
+// 因此归并结果在任意线程数下逐字节一致。
+// ============================================================
+
+namespace ecs {
+
+// 单个工作块的Effect缓冲（只由一个线程写入）
+class EffectShard {
+public:
+    template<typename T, typename = std::enable_if_t<is_effect_v<T>>>
+    void record(const T& e) {
+        effects_.push_back(e);
+        entities_.push_back(effect_entity(e));
+    }
+
+    size_t size() const { return effects_.size(); }
+    bool empty() const { return effects_.empty(); }
+
+    void clear() {
+        effects_.clear();
+        entities_.clear();
+    }
+
+    // 按实体ID稳定排序后写入recorder（同一实体保持记录顺序）
+    void drain_into(EffectRecorder& recorder);
+
+    // Effect所属的实体（Reproduction取父代，RegionChanged为0）
+    static EntityId effect_entity(const effect::Effect& e);
+
+private:
+    std::vector<effect::Effect> effects_;
+    std::vector<EntityId> entities_;
+    std::vector<uint32_t> order_;  // 复用的排序缓冲
+};
+
+class EffectShardSet {
+public:
+    // 为系统准备 chunk_count 个分片（须在并行区之前、由调度线程调用）
+    // 返回的分片按chunk下标访问，并行区内各chunk只写自己的分片
+    std::vector<EffectShard>& prepare(uint32_t system, size_t chunk_count);
+
+    // tick屏障：按 system → chunk → entity 的顺序归并进recorder并清空分片
+    void merge_into(EffectRecorder& recorder);
+
+    size_t pending() const;
+
+private:
+    std::map<uint32_t, std::vector<EffectShard>> systems_;  // 有序：按系统ID归并
+};
+
+} // namespace ecs
@@ -0,0 +1,88 @@
+#include "FoodDynamics.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace process::dynamics {
+
+void FoodDynamics::execute(ProcessContext& ctx, float dt) {
+    last_consumption_ = 0.0;
+    if (!is_enabled() || dt <= 0.0f) {
+        return;
+    }
+
+    auto& state = ctx.get_state();
+    const auto& regions = state.get_all_regions();
+    const size_t n = regions.size();
+
+    // 1. Region状态转为SoA（std::map有序，种群按二分查找定位Region）
+    region_ids_.resize(n);
+    capacity_.resize(n);
+    food_.resize(n);
+    temperature_.resize(n);
+    demand_.assign(n, 0.0f);
+
+    size_t i = 0;
+    for (const auto& [id, region] : regions) {
+        region_ids_[i] = id;
+        capacity_[i] = region.food_capacity;
+        food_[i] = region.current_food;
+        temperature_[i] = region.temperature;
+        ++i;
+    }
+
+    // 2. 每个种群的食物需求累加到所在Region（HQ种群按存活个体数计）
+    for (EntityId pop_id : ctx.get_registry().view<component::Population>()) {
+        const auto& pop = ctx.get<component::Population>(pop_id);
+
+        auto region_it = std::lower_bound(region_ids_.begin(), region_ids_.end(), pop.region_id);
+        auto species_result = ctx.get_species_template(pop.species_id);
+        if (region_it == region_ids_.end() || *region_it != pop.region_id || species_result.is_err()) {
+            continue;
+        }
+
+        uint32_t count = pop.estimated_count;
+        if (pop.mode == component::Population::Mode::DerivedFromIndividuals) {
+            const auto* moments = ctx.get_gene_stats().find(pop.region_id, pop.species_id);
+            count = moments ? moments->count() : 0;
+        }
+        demand_[region_it - region_ids_.begin()] += species_result.value().get().food_requirement * count;
+    }
+
+    // 3. 无分支的恢复/消耗更新，便于编译器向量化
+    const float regrowth = config_.regrowth_rate;
+    const float consumption = config_.consumption_rate;
+    const float optimal = config_.optimal_temperature;
+    const float inv_range = config_.temperature_range > 0.0f ? 1.0f / config_.temperature_range : 0.0f;
+    const float min_factor = std::clamp(config_.min_temperature_factor, 0.0f, 1.0f);
+    const float min_fraction = std::clamp(config_.min_food_fraction, 0.0f, 1.0f);
+
+    float* food = food_.data();
+    float* demand = demand_.data();  // 更新后改存本步的实际消耗
+    const float* capacity = capacity_.data();
+    const float* temperature = temperature_.data();
+
+    for (size_t r = 0; r < n; ++r) {
+        float factor = std::clamp(1.0f - std::abs(temperature[r] - optimal) * inv_range, min_factor, 1.0f);
+        float eaten = std::min(consumption * demand[r] * dt, food[r]);
+        float next = food[r] + regrowth * factor * (capacity[r] - food[r]) * dt - eaten;
+        food[r] = std::clamp(next, min_fraction * capacity[r], capacity[r]);
+        demand[r] = eaten;
+    }
+    last_consumption_ = std::accumulate(demand_.begin(), demand_.end(), 0.0);
+
+    // 4. 写回（数值变化的Region记录Effect，回放据此恢复承载力）
+    for (size_t r = 0; r < n; ++r) {
+        auto region_result = state.get_region(region_ids_[r]);
+        if (region_result.is_err()) {
+            continue;
+        }
+        Region& region = region_result.value().get();
+        if (region.current_food != food_[r]) {
+            ctx.record(effect::RegionChanged{region_ids_[r], core::sym::CurrentFood, region.current_food, food_[r]});
+            region.current_food = food_[r];
+        }
+    }
+}
+
+} // namespace process::dynamics
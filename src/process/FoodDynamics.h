@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ProcessContext.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// Region食物资源动态
+// 每步对所有Region做一次SoA遍历：
+//   dF/dt = regrowth_rate * g(T) * (C - F) - consumption_rate * Σ_p food_requirement_p * N_p
+//   g(T)  = clamp(1 - |T - optimal_temperature| / temperature_range, min_temperature_factor, 1)
+// 结果截断在 [min_food_fraction * C, C]。种群增长的承载力读取实时食物 F / food_requirement，
+// 过度啃食会压低承载力，食物恢复后承载力随之回升。
+// 未启用时 current_food 保持为 food_capacity，承载力与原模型一致。
+// ============================================================
+
+namespace process::dynamics {
+
+class FoodDynamics {
+public:
+    struct Config {
+        bool enabled = false;
+        float regrowth_rate = 0.2f;         // 每天恢复缺口的比例
+        float consumption_rate = 0.1f;      // 每个个体每天消耗 food_requirement 的比例
+        float optimal_temperature = 20.0f;  // 植被生长最适温度
+        float temperature_range = 20.0f;    // 偏离该温度时恢复率降为下限
+        float min_temperature_factor = 0.1f;
+        float min_food_fraction = 0.05f;    // 食物下限（避免承载力为0）
+    };
+
+    void set_config(const Config& config) { config_ = config; }
+    const Config& get_config() const { return config_; }
+    bool is_enabled() const { return config_.enabled; }
+
+    // 推进dt时间的食物恢复与消耗，写回 Region::current_food
+    void execute(ProcessContext& ctx, float dt);
+
+    // 上一步所有Region的总消耗量
+    double get_last_consumption() const { return last_consumption_; }
+
+private:
+    Config config_;
+    double last_consumption_ = 0.0;
+
+    // SoA暂存区（下标为region_ids_中的位置），跨步复用
+    std::vector<uint32_t> region_ids_;
+    std::vector<float> capacity_;
+    std::vector<float> food_;
+    std::vector<float> temperature_;
+    std::vector<float> demand_;
+};
+
+} // namespace process::dynamics
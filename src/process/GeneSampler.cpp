@@ -0,0 +1,119 @@
+#include "GeneSampler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace process {
+
+GeneSampler::GeneSampler(const component::Population& pop, const SpeciesTemplate& species)
+    : species_id_(pop.species_id) {
+    mean_[0] = pop.avg_limb_length > 0 ? pop.avg_limb_length : species.limb_length_mean;
+    mean_[1] = pop.avg_body_mass > 0 ? pop.avg_body_mass : species.body_mass_mean;
+    mean_[2] = pop.avg_size_scale > 0 ? pop.avg_size_scale : species.size_scale_mean;
+    float s0 = pop.std_limb_length > 0 ? pop.std_limb_length : species.limb_length_std;
+    float s1 = pop.std_body_mass > 0 ? pop.std_body_mass : species.body_mass_std;
+    float s2 = pop.std_size_scale > 0 ? pop.std_size_scale : species.size_scale_std;
+
+    // 相关矩阵的Cholesky分解再按标准差缩放；相关系数为0时因子退化为对角阵 diag(s0, s1, s2)
+    // 舍入导致相关矩阵不正定时，根号内截断为0（退化为完全相关）
+    float r01 = std::clamp(pop.corr_limb_mass, -1.0f, 1.0f);
+    float r02 = std::clamp(pop.corr_limb_scale, -1.0f, 1.0f);
+    float r12 = std::clamp(pop.corr_mass_scale, -1.0f, 1.0f);
+
+    float c11 = std::sqrt(std::max(0.0f, 1.0f - r01 * r01));
+    float c21 = c11 > 0.0f ? (r12 - r01 * r02) / c11 : 0.0f;
+    float c22 = std::sqrt(std::max(0.0f, 1.0f - r02 * r02 - c21 * c21));
+
+    l00_ = s0;
+    l10_ = s1 * r01;
+    l11_ = s1 * c11;
+    l20_ = s2 * r02;
+    l21_ = s2 * c21;
+    l22_ = s2 * c22;
+
+    attr_mean_[0] = species.base_strength_mean;
+    attr_mean_[1] = species.base_agility_mean;
+    attr_mean_[2] = species.base_endurance_mean;
+    attr_mean_[3] = species.base_intellect_mean;
+    attr_std_[0] = species.base_strength_std;
+    attr_std_[1] = species.base_agility_std;
+    attr_std_[2] = species.base_endurance_std;
+    attr_std_[3] = species.base_intellect_std;
+}
+
+void GeneSampler::transform(float* z, size_t stride, size_t count) const {
+    float* z0 = z;
+    float* z1 = z + stride;
+    float* z2 = z + 2 * stride;
+
+    for (size_t i = 0; i < count; ++i) {
+        float a = z0[i], b = z1[i], c = z2[i];
+        z0[i] = std::max(0.1f, mean_[0] + l00_ * a);
+        z1[i] = std::max(0.1f, mean_[1] + (l10_ * a + l11_ * b));
+        z2[i] = std::max(0.5f, mean_[2] + (l20_ * a + l21_ * b + l22_ * c));
+    }
+
+    for (size_t k = 0; k < 4; ++k) {
+        float* row = z + (3 + k) * stride;
+        const float mean = attr_mean_[k];
+        const float stddev = attr_std_[k];
+        for (size_t i = 0; i < count; ++i) {
+            row[i] = std::max(1.0f, mean + stddev * row[i]);
+        }
+    }
+}
+
+::GameplayGene GeneSampler::make_gene(const float* z, size_t stride, uint32_t seed) const {
+    ::GameplayGene gene;
+    gene.species_id = species_id_;
+    gene.seed = seed;
+
+    gene.limb_length = z[0];
+    gene.body_mass = z[stride];
+    gene.size_scale = z[2 * stride];
+
+    gene.base_strength = z[3 * stride];
+    gene.base_agility = z[4 * stride];
+    gene.base_endurance = z[5 * stride];
+    gene.base_intellect = z[6 * stride];
+
+    gene.has_wings = false;
+    gene.has_horn = false;
+
+    return gene;
+}
+
+::GameplayGene GeneSampler::sample(core::CounterRng& rng) const {
+    float z[kNormals];
+    rng.fill_normal(z, kNormals);
+    uint32_t seed = rng.next_u32();
+
+    transform(z, 1, 1);
+    return make_gene(z, 1, seed);
+}
+
+void GeneSampler::sample_batch(const EntityId* ids, size_t count, uint64_t world_seed, ::GameplayGene* out) {
+    z_.resize(kNormals * count);
+    seeds_.resize(count);
+
+    // 1. 逐个体生成正态数（每个个体独立的随机流），转置为SoA
+    for (size_t i = 0; i < count; ++i) {
+        core::CounterRng rng(world_seed, ids[i], core::RngStream::Gene);
+        float z[kNormals];
+        rng.fill_normal(z, kNormals);
+        seeds_[i] = rng.next_u32();
+
+        for (size_t k = 0; k < kNormals; ++k) {
+            z_[k * count + i] = z[k];
+        }
+    }
+
+    // 2. 整批做仿射变换
+    transform(z_.data(), count, count);
+
+    // 3. 组装基因
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = make_gene(z_.data() + i, count, seeds_[i]);
+    }
+}
+
+} // namespace process
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "components/Components.h"
+#include "simulation/SpeciesTemplate.h"
+#include "core/Random.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// 相关性状的基因采样（多元正态分布）
+// 肢长/体重/体型三个性状按种群的均值向量和协方差采样：
+// 协方差由标准差和相关系数组成，构造时做一次Cholesky分解，
+// 之后每个个体只需 x = mean + L·z。
+// 批量采样先为每个个体生成标准正态数（按个体ID的随机流，与生成顺序无关），
+// 再在SoA数组上做无分支的仿射变换，便于编译器向量化。
+// ============================================================
+
+namespace process {
+
+class GeneSampler {
+public:
+    // 种群统计缺省（均值/标准差为0）时使用物种模板
+    GeneSampler(const component::Population& pop, const SpeciesTemplate& species);
+
+    // 单个采样（与sample_batch对同一随机流的结果一致）
+    ::GameplayGene sample(core::CounterRng& rng) const;
+
+    // 为ids中的每个个体采样基因，随机流为 (world_seed, id, RngStream::Gene)
+    void sample_batch(const EntityId* ids, size_t count, uint64_t world_seed, ::GameplayGene* out);
+
+private:
+    // 每个个体消耗的标准正态数：3个相关性状 + 4个独立属性
+    static constexpr size_t kNormals = 7;
+
+    // 把SoA排列的标准正态数（第k行起始于 z + k * stride）原地变换为性状值
+    void transform(float* z, size_t stride, size_t count) const;
+
+    // 从变换后的SoA数组中取出一个个体的基因
+    ::GameplayGene make_gene(const float* z, size_t stride, uint32_t seed) const;
+
+    SpeciesId species_id_;
+
+    // 相关性状的均值和Cholesky因子（下三角，行优先：l00; l10 l11; l20 l21 l22）
+    float mean_[3];
+    float l00_, l10_, l11_, l20_, l21_, l22_;
+
+    // 独立属性（力量/敏捷/耐力/智力）
+    float attr_mean_[4];
+    float attr_std_[4];
+
+    // 批量采样的SoA暂存区：z_[k * count + i] 为第i个个体的第k个正态数
+    std::vector<float> z_;
+    std::vector<uint32_t> seeds_;
+};
+
+} // namespace process
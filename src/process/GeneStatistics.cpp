@@ -0,0 +1,99 @@
+#include "GeneStatistics.h"
+#include <algorithm>
+#include <cmath>
+
+namespace process {
+
+double WelfordAccumulator::stddev() const {
+    return std::sqrt(variance());
+}
+
+namespace {
+
+// 由交叉离差积和两个方差的离差平方和求相关系数
+float correlation(double c, const WelfordAccumulator& x, const WelfordAccumulator& y) {
+    double denom = std::sqrt(x.m2 * y.m2);
+    if (denom <= 0.0) {
+        return 0.0f;
+    }
+    return static_cast<float>(std::clamp(c / denom, -1.0, 1.0));
+}
+
+} // namespace
+
+void GeneMoments::add(const ::GameplayGene& gene) {
+    // C += (x - 旧mean_x)(y - 新mean_y)
+    double dx = gene.limb_length - limb_length.mean;
+    double dy = gene.body_mass - body_mass.mean;
+
+    limb_length.add(gene.limb_length);
+    body_mass.add(gene.body_mass);
+    size_scale.add(gene.size_scale);
+
+    double dz_new = gene.size_scale - size_scale.mean;
+    c_limb_mass += dx * (gene.body_mass - body_mass.mean);
+    c_limb_scale += dx * dz_new;
+    c_mass_scale += dy * dz_new;
+}
+
+void GeneMoments::remove(const ::GameplayGene& gene) {
+    if (count() <= 1) {
+        *this = {};
+        return;
+    }
+
+    // add的逆运算：C -= (x - 移除后mean_x)(y - 移除前mean_y)
+    double old_mass_mean = body_mass.mean;
+    double old_scale_mean = size_scale.mean;
+
+    limb_length.remove(gene.limb_length);
+    body_mass.remove(gene.body_mass);
+    size_scale.remove(gene.size_scale);
+
+    double dx = gene.limb_length - limb_length.mean;
+    double dy = gene.body_mass - body_mass.mean;
+    c_limb_mass -= dx * (gene.body_mass - old_mass_mean);
+    c_limb_scale -= dx * (gene.size_scale - old_scale_mean);
+    c_mass_scale -= dy * (gene.size_scale - old_scale_mean);
+}
+
+void GeneMoments::write_to(component::Population& pop) const {
+    pop.avg_limb_length = static_cast<float>(limb_length.mean);
+    pop.avg_body_mass = static_cast<float>(body_mass.mean);
+    pop.avg_size_scale = static_cast<float>(size_scale.mean);
+    pop.std_limb_length = static_cast<float>(limb_length.stddev());
+    pop.std_body_mass = static_cast<float>(body_mass.stddev());
+    pop.std_size_scale = static_cast<float>(size_scale.stddev());
+    pop.corr_limb_mass = correlation(c_limb_mass, limb_length, body_mass);
+    pop.corr_limb_scale = correlation(c_limb_scale, limb_length, size_scale);
+    pop.corr_mass_scale = correlation(c_mass_scale, body_mass, size_scale);
+}
+
+void GeneStatistics::add(uint32_t region_id, SpeciesId species_id, const ::GameplayGene& gene) {
+    moments_[key(region_id, species_id)].add(gene);
+}
+
+void GeneStatistics::remove(uint32_t region_id, SpeciesId species_id, const ::GameplayGene& gene) {
+    auto it = moments_.find(key(region_id, species_id));
+    if (it == moments_.end()) {
+        return;
+    }
+
+    it->second.remove(gene);
+    if (it->second.count() == 0) {
+        moments_.erase(it);
+    }
+}
+
+void GeneStatistics::move(uint32_t from_region, uint32_t to_region, SpeciesId species_id,
+                          const ::GameplayGene& gene) {
+    remove(from_region, species_id, gene);
+    add(to_region, species_id, gene);
+}
+
+const GeneMoments* GeneStatistics::find(uint32_t region_id, SpeciesId species_id) const {
+    auto it = moments_.find(key(region_id, species_id));
+    return it != moments_.end() ? &it->second : nullptr;
+}
+
+} // namespace process
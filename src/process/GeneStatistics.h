@@ -0,0 +1,88 @@
+#pragma once
+
+#include "components/Components.h"
+#include <cstdint>
+#include <unordered_map>
+
+// ============================================================
+// 个体基因的增量统计（Welford在线算法）
+// 按(Region, 物种)维护存活个体的数量、基因均值、方差和协方差，
+// 在个体生成、死亡、迁移时O(1)更新。HQ→LQ聚合直接读取结果，
+// 不再扫描全部个体；HQ种群也可以随时报告实时均值。
+// ============================================================
+
+namespace process {
+
+// 单个数值的在线均值/方差（支持删除样本）
+struct WelfordAccumulator {
+    uint32_t n = 0;
+    double mean = 0.0;
+    double m2 = 0.0;  // 与均值之差的平方和
+
+    void add(double x) {
+        ++n;
+        double delta = x - mean;
+        mean += delta / n;
+        m2 += delta * (x - mean);
+    }
+
+    void remove(double x) {
+        if (n <= 1) {
+            // 最后一个样本移除后精确归零，避免残留舍入误差
+            *this = {};
+            return;
+        }
+        double old_mean = mean;
+        --n;
+        mean = (old_mean * (n + 1) - x) / n;
+        m2 -= (x - old_mean) * (x - mean);
+        if (m2 < 0.0) {
+            m2 = 0.0;
+        }
+    }
+
+    // 总体方差（与原两遍扫描的统计口径一致）
+    double variance() const { return n > 0 ? m2 / n : 0.0; }
+    double stddev() const;
+};
+
+// 某Region某物种存活个体的基因统计（含性状两两之间的协方差）
+struct GeneMoments {
+    WelfordAccumulator limb_length;
+    WelfordAccumulator body_mass;
+    WelfordAccumulator size_scale;
+
+    // 交叉离差积之和 Σ(x - mean_x)(y - mean_y)
+    double c_limb_mass = 0.0;
+    double c_limb_scale = 0.0;
+    double c_mass_scale = 0.0;
+
+    uint32_t count() const { return limb_length.n; }
+
+    void add(const ::GameplayGene& gene);
+    void remove(const ::GameplayGene& gene);
+
+    // 写入种群的均值/标准差/相关系数字段
+    void write_to(component::Population& pop) const;
+};
+
+class GeneStatistics {
+public:
+    void add(uint32_t region_id, SpeciesId species_id, const ::GameplayGene& gene);
+    void remove(uint32_t region_id, SpeciesId species_id, const ::GameplayGene& gene);
+    void move(uint32_t from_region, uint32_t to_region, SpeciesId species_id, const ::GameplayGene& gene);
+
+    // 没有存活个体时返回nullptr
+    const GeneMoments* find(uint32_t region_id, SpeciesId species_id) const;
+
+    void clear() { moments_.clear(); }
+
+private:
+    static uint64_t key(uint32_t region_id, SpeciesId species_id) {
+        return (static_cast<uint64_t>(region_id) << 32) | species_id;
+    }
+
+    std::unordered_map<uint64_t, GeneMoments> moments_;
+};
+
+} // namespace process
@@ -0,0 +1,204 @@
+#include "Integrator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace process::dynamics {
+
+namespace {
+
+// Dormand-Prince 5(4) 系数
+constexpr double a21 = 1.0 / 5.0;
+constexpr double a31 = 3.0 / 40.0, a32 = 9.0 / 40.0;
+constexpr double a41 = 44.0 / 45.0, a42 = -56.0 / 15.0, a43 = 32.0 / 9.0;
+constexpr double a51 = 19372.0 / 6561.0, a52 = -25360.0 / 2187.0, a53 = 64448.0 / 6561.0,
+                 a54 = -212.0 / 729.0;
+constexpr double a61 = 9017.0 / 3168.0, a62 = -355.0 / 33.0, a63 = 46732.0 / 5247.0,
+                 a64 = 49.0 / 176.0, a65 = -5103.0 / 18656.0;
+// 5阶解（同时作为第7级的输入，FSAL）
+constexpr double b1 = 35.0 / 384.0, b3 = 500.0 / 1113.0, b4 = 125.0 / 192.0,
+                 b5 = -2187.0 / 6784.0, b6 = 11.0 / 84.0;
+// 5阶解与4阶解之差（误差估计）
+constexpr double e1 = 71.0 / 57600.0, e3 = -71.0 / 16695.0, e4 = 71.0 / 1920.0,
+                 e5 = -17253.0 / 339200.0, e6 = 22.0 / 525.0, e7 = -1.0 / 40.0;
+
+// 数量不能为负；返回是否发生截断
+bool clamp_non_negative(double* N, size_t n) {
+    bool clamped = false;
+    for (size_t i = 0; i < n; ++i) {
+        if (N[i] < 0.0) {
+            N[i] = 0.0;
+            clamped = true;
+        }
+    }
+    return clamped;
+}
+
+} // namespace
+
+const char* integrator_mode_name(IntegratorMode mode) {
+    switch (mode) {
+        case IntegratorMode::Euler: return "Euler";
+        case IntegratorMode::RK4: return "RK4";
+        case IntegratorMode::RK45: return "RK45";
+    }
+    return "Unknown";
+}
+
+IntegrationStats PopulationIntegrator::integrate(RegionBatch& batch, double elapsed) {
+    if (elapsed <= 0.0 || batch.size() == 0) {
+        return IntegrationStats{};
+    }
+
+    const size_t n = batch.size();
+    for (auto& k : k_) {
+        k.resize(n);
+    }
+    tmp_.resize(n);
+    y5_.resize(n);
+
+    if (mode_ == IntegratorMode::RK45) {
+        return integrate_adaptive(batch, elapsed);
+    }
+    return integrate_fixed(batch, elapsed);
+}
+
+IntegrationStats PopulationIntegrator::integrate_fixed(RegionBatch& batch, double elapsed) {
+    IntegrationStats stats;
+    const size_t n = batch.size();
+    double* N = batch.count.data();
+
+    double max_step = std::max(options_.min_step, options_.max_step);
+    uint32_t steps = static_cast<uint32_t>(std::ceil(elapsed / max_step));
+    double h = elapsed / steps;
+
+    for (uint32_t s = 0; s < steps; ++s) {
+        if (mode_ == IntegratorMode::Euler) {
+            derivative(batch, N, k_[0].data());
+            for (size_t i = 0; i < n; ++i) {
+                N[i] += h * k_[0][i];
+            }
+            stats.evaluations += 1;
+        } else {
+            rk4_step(batch, N, h);
+            stats.evaluations += 4;
+        }
+        clamp_non_negative(N, n);
+        ++stats.steps;
+    }
+
+    return stats;
+}
+
+void PopulationIntegrator::rk4_step(const RegionBatch& batch, double* N, double h) {
+    const size_t n = batch.size();
+    double* k1 = k_[0].data();
+    double* k2 = k_[1].data();
+    double* k3 = k_[2].data();
+    double* k4 = k_[3].data();
+    double* tmp = tmp_.data();
+
+    derivative(batch, N, k1);
+
+    for (size_t i = 0; i < n; ++i) tmp[i] = N[i] + 0.5 * h * k1[i];
+    derivative(batch, tmp, k2);
+
+    for (size_t i = 0; i < n; ++i) tmp[i] = N[i] + 0.5 * h * k2[i];
+    derivative(batch, tmp, k3);
+
+    for (size_t i = 0; i < n; ++i) tmp[i] = N[i] + h * k3[i];
+    derivative(batch, tmp, k4);
+
+    for (size_t i = 0; i < n; ++i) {
+        N[i] += h / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+}
+
+IntegrationStats PopulationIntegrator::integrate_adaptive(RegionBatch& batch, double elapsed) {
+    IntegrationStats stats;
+    const size_t n = batch.size();
+    double* N = batch.count.data();
+    double* k1 = k_[0].data();
+    double* k2 = k_[1].data();
+    double* k3 = k_[2].data();
+    double* k4 = k_[3].data();
+    double* k5 = k_[4].data();
+    double* k6 = k_[5].data();
+    double* k7 = k_[6].data();
+    double* tmp = tmp_.data();
+    double* y5 = y5_.data();
+
+    const double max_step = std::max(options_.min_step, options_.max_step);
+    double h = last_step_ > 0.0 ? std::min(last_step_, max_step) : max_step;
+    double t = 0.0;
+
+    derivative(batch, N, k1);
+    stats.evaluations += 1;
+
+    while (t < elapsed) {
+        double step = std::min(h, elapsed - t);
+
+        for (size_t i = 0; i < n; ++i) tmp[i] = N[i] + step * a21 * k1[i];
+        derivative(batch, tmp, k2);
+
+        for (size_t i = 0; i < n; ++i) tmp[i] = N[i] + step * (a31 * k1[i] + a32 * k2[i]);
+        derivative(batch, tmp, k3);
+
+        for (size_t i = 0; i < n; ++i) tmp[i] = N[i] + step * (a41 * k1[i] + a42 * k2[i] + a43 * k3[i]);
+        derivative(batch, tmp, k4);
+
+        for (size_t i = 0; i < n; ++i) {
+            tmp[i] = N[i] + step * (a51 * k1[i] + a52 * k2[i] + a53 * k3[i] + a54 * k4[i]);
+        }
+        derivative(batch, tmp, k5);
+
+        for (size_t i = 0; i < n; ++i) {
+            tmp[i] = N[i] + step * (a61 * k1[i] + a62 * k2[i] + a63 * k3[i] + a64 * k4[i] + a65 * k5[i]);
+        }
+        derivative(batch, tmp, k6);
+
+        for (size_t i = 0; i < n; ++i) {
+            y5[i] = N[i] + step * (b1 * k1[i] + b3 * k3[i] + b4 * k4[i] + b5 * k5[i] + b6 * k6[i]);
+        }
+        derivative(batch, y5, k7);
+        stats.evaluations += 6;
+
+        // 误差范数（混合绝对/相对容限）
+        double err_norm = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            double err = step * (e1 * k1[i] + e3 * k3[i] + e4 * k4[i] + e5 * k5[i] + e6 * k6[i] + e7 * k7[i]);
+            double scale = options_.abs_tol + options_.rel_tol * std::max(std::abs(N[i]), std::abs(y5[i]));
+            err_norm = std::max(err_norm, std::abs(err) / scale);
+        }
+
+        if (err_norm <= 1.0 || step <= options_.min_step) {
+            // 接受本步
+            t += step;
+            std::copy(y5, y5 + n, N);
+            ++stats.steps;
+
+            // FSAL：k7即下一步的k1；截断为非负后需重新求值
+            if (clamp_non_negative(N, n)) {
+                derivative(batch, N, k1);
+                stats.evaluations += 1;
+            } else {
+                std::swap(k_[0], k_[6]);
+                k1 = k_[0].data();
+                k7 = k_[6].data();
+            }
+
+            double factor = (err_norm == 0.0) ? 5.0 : std::clamp(0.9 * std::pow(err_norm, -0.2), 0.2, 5.0);
+            // 被剩余时间截短的最后一步不参与步长增长
+            if (step == h) {
+                h = std::min(max_step, h * factor);
+            }
+        } else {
+            ++stats.rejected;
+            h = std::max(options_.min_step, step * std::max(0.2, 0.9 * std::pow(err_norm, -0.25)));
+        }
+    }
+
+    last_step_ = h;
+    return stats;
+}
+
+} // namespace process::dynamics
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "PopulationDynamics.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// 种群ODE积分器
+// 在Region批量状态向量上积分 dN/dt（见PopulationDynamics.h）
+// - Euler：显式欧拉（对照用）
+// - RK4：经典四阶Runge-Kutta，固定步长
+// - RK45：Dormand-Prince 5(4) 嵌入式方法，按误差自适应步长
+// 状态保持连续值，积分过程中不截断为整数
+// ============================================================
+
+namespace process::dynamics {
+
+enum class IntegratorMode {
+    Euler,
+    RK4,
+    RK45
+};
+
+const char* integrator_mode_name(IntegratorMode mode);
+
+struct IntegratorOptions {
+    double max_step = 5.0;     // 最大步长（天），Euler/RK4即为固定步长
+    double min_step = 1e-3;    // RK45最小步长
+    double rel_tol = 1e-4;     // RK45相对误差容限
+    double abs_tol = 1e-2;     // RK45绝对误差容限（个体数）
+};
+
+// 积分统计（用于精度/开销对比）
+struct IntegrationStats {
+    uint32_t steps = 0;         // 接受的步数
+    uint32_t rejected = 0;      // RK45拒绝的步数
+    uint32_t evaluations = 0;   // dN/dt 求值次数
+
+    IntegrationStats& operator+=(const IntegrationStats& other) {
+        steps += other.steps;
+        rejected += other.rejected;
+        evaluations += other.evaluations;
+        return *this;
+    }
+};
+
+class PopulationIntegrator {
+public:
+    PopulationIntegrator() = default;
+    PopulationIntegrator(IntegratorMode mode, const IntegratorOptions& options)
+        : mode_(mode), options_(options) {}
+
+    // 把 batch.count 推进 elapsed 时间（原地修改）
+    IntegrationStats integrate(RegionBatch& batch, double elapsed);
+
+    IntegratorMode get_mode() const { return mode_; }
+    void set_mode(IntegratorMode mode) { mode_ = mode; }
+
+    const IntegratorOptions& get_options() const { return options_; }
+    void set_options(const IntegratorOptions& options) { options_ = options; }
+
+private:
+    IntegrationStats integrate_fixed(RegionBatch& batch, double elapsed);
+    IntegrationStats integrate_adaptive(RegionBatch& batch, double elapsed);
+
+    void rk4_step(const RegionBatch& batch, double* N, double h);
+
+    IntegratorMode mode_ = IntegratorMode::RK45;
+    IntegratorOptions options_;
+
+    // 复用的缓冲
+    std::vector<double> k_[7];
+    std::vector<double> tmp_, y5_;
+    double last_step_ = 0.0;  // RK45上次接受的步长（作为下次的初始步长）
+};
+
+} // namespace process::dynamics
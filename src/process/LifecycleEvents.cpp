@@ -0,0 +1,154 @@
+#include "LifecycleEvents.h"
+#include <algorithm>
+#include <tuple>
+
+namespace process::lifecycle {
+
+LifecycleEvents::LifecycleEvents(double resolution)
+    : wheel_(resolution) {
+}
+
+void LifecycleEvents::track(ProcessContext& ctx, EntityId creature_id) {
+    if (!ctx.has<component::Lifecycle>(creature_id)) {
+        return;
+    }
+
+    auto& registry = ctx.get_registry();
+    if (!ctx.has<component::LifecycleSchedule>(creature_id)) {
+        registry.add_component(creature_id, component::LifecycleSchedule{now_, 0});
+    }
+
+    reschedule(ctx, creature_id);
+}
+
+void LifecycleEvents::track_all(ProcessContext& ctx) {
+    // 复制一份ID列表：track会向LifecycleSchedule池添加组件
+    std::vector<EntityId> creatures = ctx.get_registry().view<component::Lifecycle>();
+    for (EntityId creature_id : creatures) {
+        track(ctx, creature_id);
+    }
+}
+
+void LifecycleEvents::reschedule(ProcessContext& ctx, EntityId creature_id) {
+    if (!ctx.has<component::Lifecycle>(creature_id) ||
+        !ctx.has<component::LifecycleSchedule>(creature_id)) {
+        return;
+    }
+
+    // 当前Lifecycle数值视为now_时刻的值
+    auto& schedule = ctx.get<component::LifecycleSchedule>(creature_id);
+    schedule.anchor_time = now_;
+    ++schedule.generation;
+
+    schedule_events(creature_id, ctx.get<component::Lifecycle>(creature_id), schedule);
+}
+
+void LifecycleEvents::schedule_events(EntityId creature_id, const component::Lifecycle& life,
+                                      const component::LifecycleSchedule& schedule) {
+    wheel_.schedule(schedule.anchor_time + time_until_death(life),
+                    Event{creature_id, schedule.generation, EventKind::Death});
+
+    double hungry_in = time_until_hungry(life);
+    if (hungry_in >= 0.0) {
+        wheel_.schedule(schedule.anchor_time + hungry_in,
+                        Event{creature_id, schedule.generation, EventKind::Hungry});
+    }
+}
+
+size_t LifecycleEvents::advance(ProcessContext& ctx, float dt) {
+    now_ += dt;
+    ctx.get_state().lifecycle_clock = now_;
+
+    fired_.clear();
+    wheel_.advance(now_, fired_);
+
+    // 同一步内按到期时间处理，保证Effect顺序确定
+    std::sort(fired_.begin(), fired_.end(), [](const auto& a, const auto& b) {
+        return std::tie(a.due_time, a.payload.creature_id, a.payload.kind) <
+               std::tie(b.due_time, b.payload.creature_id, b.payload.kind);
+    });
+
+    for (const auto& entry : fired_) {
+        fire(ctx, entry);
+    }
+
+    return fired_.size();
+}
+
+void LifecycleEvents::fire(ProcessContext& ctx, const TimingWheel<Event>::Entry& entry) {
+    const Event& event = entry.payload;
+
+    // 个体已被销毁（如HQ→LQ转换）或事件已过期
+    if (!ctx.has<component::Lifecycle>(event.creature_id) ||
+        !ctx.has<component::LifecycleSchedule>(event.creature_id)) {
+        return;
+    }
+    auto& schedule = ctx.get<component::LifecycleSchedule>(event.creature_id);
+    if (schedule.generation != event.generation) {
+        return;
+    }
+
+    const auto& life = ctx.get<component::Lifecycle>(event.creature_id);
+    component::Lifecycle now_life = project(life, now_ - schedule.anchor_time);
+
+    switch (event.kind) {
+    case EventKind::Death: {
+        uint8_t causes = death_causes(now_life);
+        if (causes == 0) {
+            // tick粒度内尚未真正到期，留到下一tick
+            wheel_.schedule(entry.due_time, event);
+            return;
+        }
+
+        core::Symbol cause = death_cause(causes);
+        ctx.record(effect::Death{event.creature_id, cause});
+        ctx.defer_destroy(event.creature_id, cause);
+
+        // 作废该个体剩余的事件
+        ++schedule.generation;
+        break;
+    }
+    case EventKind::Hungry:
+        if (now_life.hunger < kHungryThreshold) {
+            wheel_.schedule(entry.due_time, event);
+            return;
+        }
+        ctx.record(effect::ResourceChanged{
+            event.creature_id, core::sym::Hunger, life.hunger, now_life.hunger
+        });
+        break;
+    }
+}
+
+component::Lifecycle LifecycleEvents::current(const ProcessContext& ctx, EntityId creature_id) const {
+    const auto& life = ctx.get<component::Lifecycle>(creature_id);
+    if (!ctx.has<component::LifecycleSchedule>(creature_id)) {
+        return life;
+    }
+    const auto& schedule = ctx.get<component::LifecycleSchedule>(creature_id);
+    return project(life, now_ - schedule.anchor_time);
+}
+
+component::Lifecycle& LifecycleEvents::materialize(ProcessContext& ctx, EntityId creature_id) {
+    auto& life = ctx.get<component::Lifecycle>(creature_id);
+    if (ctx.has<component::LifecycleSchedule>(creature_id)) {
+        auto& schedule = ctx.get<component::LifecycleSchedule>(creature_id);
+        life = project(life, now_ - schedule.anchor_time);
+        schedule.anchor_time = now_;
+    }
+    return life;
+}
+
+void LifecycleEvents::materialize_all(ProcessContext& ctx) {
+    std::vector<EntityId> tracked = ctx.get_registry().view<component::LifecycleSchedule>();
+    for (EntityId creature_id : tracked) {
+        if (ctx.has<component::Lifecycle>(creature_id)) {
+            materialize(ctx, creature_id);
+        }
+        ctx.get_registry().remove_component<component::LifecycleSchedule>(creature_id);
+    }
+
+    wheel_.reset(now_);
+}
+
+} // namespace process::lifecycle
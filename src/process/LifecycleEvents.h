@@ -0,0 +1,73 @@
+#pragma once
+
+#include "ProcessContext.h"
+#include "components/Components.h"
+#include "LifecycleKernel.h"
+#include "TimingWheel.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// 事件驱动的生命周期
+// 年龄和饥饿度随时间线性变化，死亡时刻在调度时即可算出。
+// 每个个体只在时间轮中挂一个死亡事件（和一个饥饿阈值事件），
+// 每步的代价与到期事件数成正比，而不是与存活个体数成正比。
+// Lifecycle组件保存 anchor_time 时刻的数值，查询时惰性推算。
+// ============================================================
+
+namespace process::lifecycle {
+
+class LifecycleEvents {
+public:
+    explicit LifecycleEvents(double resolution = 0.1);
+
+    // 生命周期时钟（天），推进时同步到 SimulationState::lifecycle_clock
+    double get_time() const { return now_; }
+
+    // 开始跟踪个体：以当前时刻为基准，挂起死亡/饥饿事件
+    void track(ProcessContext& ctx, EntityId creature_id);
+
+    // 跟踪所有带Lifecycle的个体（从逐帧遍历模式切换过来时调用）
+    void track_all(ProcessContext& ctx);
+
+    // Lifecycle被外部修改后重新调度（旧事件按generation作废）
+    void reschedule(ProcessContext& ctx, EntityId creature_id);
+
+    // 推进时钟dt，处理到期事件：记录Death/饥饿Effect，死亡个体交给延迟销毁
+    // 返回本步处理的事件数
+    size_t advance(ProcessContext& ctx, float dt);
+
+    // 查询个体在当前时刻的生命周期数值
+    component::Lifecycle current(const ProcessContext& ctx, EntityId creature_id) const;
+
+    // 把个体的Lifecycle写回到当前时刻并返回（修改数值后需调用reschedule）
+    component::Lifecycle& materialize(ProcessContext& ctx, EntityId creature_id);
+
+    // 把所有个体的数值写回到当前时刻并停止跟踪（切换回逐帧遍历模式时调用）
+    void materialize_all(ProcessContext& ctx);
+
+    size_t pending_events() const { return wheel_.size(); }
+
+private:
+    enum class EventKind : uint8_t {
+        Death,
+        Hungry,
+    };
+
+    struct Event {
+        EntityId creature_id;
+        uint32_t generation;
+        EventKind kind;
+    };
+
+    void schedule_events(EntityId creature_id, const component::Lifecycle& life,
+                         const component::LifecycleSchedule& schedule);
+
+    void fire(ProcessContext& ctx, const TimingWheel<Event>::Entry& entry);
+
+    double now_ = 0.0;
+    TimingWheel<Event> wheel_;
+    std::vector<TimingWheel<Event>::Entry> fired_;  // 复用的到期事件缓冲
+};
+
+} // namespace process::lifecycle
@@ -0,0 +1,198 @@
+#include "LifecycleKernel.h"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define GW_LIFECYCLE_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GW_LIFECYCLE_SSE2 1
+#endif
+
+namespace process::lifecycle {
+
+// 内核按 {age, lifespan, hunger, health} 的内存布局直接加载组件
+static_assert(sizeof(component::Lifecycle) == 4 * sizeof(float), "Lifecycle layout changed");
+static_assert(offsetof(component::Lifecycle, age) == 0, "Lifecycle layout changed");
+static_assert(offsetof(component::Lifecycle, lifespan) == 4, "Lifecycle layout changed");
+static_assert(offsetof(component::Lifecycle, hunger) == 8, "Lifecycle layout changed");
+static_assert(offsetof(component::Lifecycle, health) == 12, "Lifecycle layout changed");
+
+namespace {
+
+// 每个个体的比较结果压成4位（与组件字段一一对应）：
+//   bit0 = age > lifespan, bit2 = hunger > 0.95, bit3 = health < 0.05
+constexpr uint32_t kNibbleOldAge = 1u << 0;
+constexpr uint32_t kNibbleStarvation = 1u << 2;
+constexpr uint32_t kNibbleIllness = 1u << 3;
+
+uint8_t nibble_to_causes(uint32_t nibble) {
+    uint8_t causes = 0;
+    if (nibble & kNibbleStarvation) causes |= kDeathStarvation;
+    if (nibble & kNibbleIllness) causes |= kDeathIllness;
+    if (nibble & kNibbleOldAge) causes |= kDeathOldAge;
+    return causes;
+}
+
+uint32_t update_one_scalar(component::Lifecycle& life, float dt, float hunger_step) {
+    life.age += dt;
+    life.hunger = std::min(1.0f, life.hunger + hunger_step);
+
+    uint32_t nibble = 0;
+    if (life.age > life.lifespan) nibble |= kNibbleOldAge;
+    if (life.hunger > kStarvationHunger) nibble |= kNibbleStarvation;
+    if (life.health < kIllnessHealth) nibble |= kNibbleIllness;
+    return nibble;
+}
+
+#if defined(GW_LIFECYCLE_AVX)
+
+// AVX：每个寄存器容纳2个个体，4个寄存器处理一组8个
+uint32_t update_block(component::Lifecycle* block, float dt, float hunger_step) {
+    const float inf = std::numeric_limits<float>::infinity();
+    const __m256 step = _mm256_setr_ps(dt, 0.0f, hunger_step, 0.0f, dt, 0.0f, hunger_step, 0.0f);
+    const __m256 clamp = _mm256_setr_ps(inf, inf, 1.0f, inf, inf, inf, 1.0f, inf);
+    const __m256 upper = _mm256_setr_ps(inf, inf, kStarvationHunger, inf, inf, inf, kStarvationHunger, inf);
+    const __m256 lower = _mm256_setr_ps(-inf, -inf, -inf, kIllnessHealth, -inf, -inf, -inf, kIllnessHealth);
+    const __m256 age_lane = _mm256_castsi256_ps(_mm256_setr_epi32(-1, 0, 0, 0, -1, 0, 0, 0));
+
+    float* base = reinterpret_cast<float*>(block);
+    uint32_t mask = 0;
+
+    for (int r = 0; r < 4; ++r) {
+        __m256 v = _mm256_loadu_ps(base + r * 8);
+        v = _mm256_min_ps(_mm256_add_ps(v, step), clamp);
+        _mm256_storeu_ps(base + r * 8, v);
+
+        // lane0 与 lane1 交换后比较：age > lifespan
+        __m256 swapped = _mm256_permute_ps(v, _MM_SHUFFLE(3, 2, 0, 1));
+        __m256 old_age = _mm256_and_ps(_mm256_cmp_ps(v, swapped, _CMP_GT_OQ), age_lane);
+        __m256 starving = _mm256_cmp_ps(v, upper, _CMP_GT_OQ);
+        __m256 ill = _mm256_cmp_ps(v, lower, _CMP_LT_OQ);
+
+        __m256 dying = _mm256_or_ps(_mm256_or_ps(old_age, starving), ill);
+        mask |= static_cast<uint32_t>(_mm256_movemask_ps(dying)) << (r * 8);
+    }
+
+    return mask;
+}
+
+#elif defined(GW_LIFECYCLE_SSE2)
+
+// SSE2：每个寄存器容纳1个个体，8个寄存器处理一组
+uint32_t update_block(component::Lifecycle* block, float dt, float hunger_step) {
+    const float inf = std::numeric_limits<float>::infinity();
+    const __m128 step = _mm_setr_ps(dt, 0.0f, hunger_step, 0.0f);
+    const __m128 clamp = _mm_setr_ps(inf, inf, 1.0f, inf);
+    const __m128 upper = _mm_setr_ps(inf, inf, kStarvationHunger, inf);
+    const __m128 lower = _mm_setr_ps(-inf, -inf, -inf, kIllnessHealth);
+    const __m128 age_lane = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+
+    float* base = reinterpret_cast<float*>(block);
+    uint32_t mask = 0;
+
+    for (int l = 0; l < static_cast<int>(kLanes); ++l) {
+        __m128 v = _mm_loadu_ps(base + l * 4);
+        v = _mm_min_ps(_mm_add_ps(v, step), clamp);
+        _mm_storeu_ps(base + l * 4, v);
+
+        __m128 swapped = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 2, 0, 1));
+        __m128 old_age = _mm_and_ps(_mm_cmpgt_ps(v, swapped), age_lane);
+        __m128 starving = _mm_cmpgt_ps(v, upper);
+        __m128 ill = _mm_cmplt_ps(v, lower);
+
+        __m128 dying = _mm_or_ps(_mm_or_ps(old_age, starving), ill);
+        mask |= static_cast<uint32_t>(_mm_movemask_ps(dying)) << (l * 4);
+    }
+
+    return mask;
+}
+
+#else
+
+uint32_t update_block(component::Lifecycle* block, float dt, float hunger_step) {
+    uint32_t mask = 0;
+    for (size_t l = 0; l < kLanes; ++l) {
+        mask |= update_one_scalar(block[l], dt, hunger_step) << (l * 4);
+    }
+    return mask;
+}
+
+#endif
+
+} // namespace
+
+void update_and_collect(component::Lifecycle* data, size_t count, float dt, DyingList& out) {
+    const float hunger_step = kHungerPerDay * dt;
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes) {
+        uint32_t mask = update_block(data + i, dt, hunger_step);
+
+        // 快速路径：整组无人死亡
+        if (mask == 0) {
+            continue;
+        }
+
+        for (size_t l = 0; l < kLanes; ++l) {
+            uint32_t nibble = (mask >> (l * 4)) & 0xFu;
+            if (nibble != 0) {
+                out.indices.push_back(static_cast<uint32_t>(i + l));
+                out.causes.push_back(nibble_to_causes(nibble));
+            }
+        }
+    }
+
+    // 尾部不足一组的个体
+    for (; i < count; ++i) {
+        uint32_t nibble = update_one_scalar(data[i], dt, hunger_step);
+        if (nibble != 0) {
+            out.indices.push_back(static_cast<uint32_t>(i));
+            out.causes.push_back(nibble_to_causes(nibble));
+        }
+    }
+}
+
+uint8_t death_causes(const component::Lifecycle& life) {
+    uint8_t causes = 0;
+    if (life.hunger > kStarvationHunger) causes |= kDeathStarvation;
+    if (life.health < kIllnessHealth) causes |= kDeathIllness;
+    if (life.age > life.lifespan) causes |= kDeathOldAge;
+    return causes;
+}
+
+core::Symbol death_cause(uint8_t causes) {
+    if (causes & kDeathStarvation) return core::sym::Starvation;
+    if (causes & kDeathIllness) return core::sym::Illness;
+    if (causes & kDeathOldAge) return core::sym::OldAge;
+    return core::sym::Unknown;
+}
+
+component::Lifecycle project(const component::Lifecycle& life, double elapsed) {
+    component::Lifecycle out = life;
+    out.age = static_cast<float>(life.age + elapsed);
+    out.hunger = std::min(1.0f, static_cast<float>(life.hunger + kHungerPerDay * elapsed));
+    return out;
+}
+
+double time_until_death(const component::Lifecycle& life) {
+    if (death_causes(life) != 0) {
+        return 0.0;
+    }
+
+    // 健康度不随时间变化，只有衰老和饥饿会到期
+    double old_age = static_cast<double>(life.lifespan) - life.age;
+    double starvation = (static_cast<double>(kStarvationHunger) - life.hunger) / kHungerPerDay;
+    return std::max(0.0, std::min(old_age, starvation));
+}
+
+double time_until_hungry(const component::Lifecycle& life) {
+    if (life.hunger >= kHungryThreshold) {
+        return -1.0;
+    }
+    return (static_cast<double>(kHungryThreshold) - life.hunger) / kHungerPerDay;
+}
+
+} // namespace process::lifecycle
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "components/Components.h"
+#include "core/Symbol.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// 生命周期批量内核
+// 直接遍历Lifecycle组件池，每8个个体为一组更新年龄/饥饿，
+// 计算死亡原因位掩码，并把死亡个体的索引压缩成列表
+// ============================================================
+
+namespace process::lifecycle {
+
+// 每组处理的个体数
+constexpr size_t kLanes = 8;
+
+// 生命周期参数（与ProcessCreatureLifecycle共用）
+constexpr float kHungerPerDay = 0.1f;        // 饥饿度每天增加量
+constexpr float kStarvationHunger = 0.95f;   // 饥饿度超过此值死亡
+constexpr float kIllnessHealth = 0.05f;      // 健康度低于此值死亡
+constexpr float kHungryThreshold = 0.5f;     // 饥饿度越过此值记录一次"饥饿"事件（事件驱动模式）
+
+// 死亡原因位（一个个体可能同时满足多个条件）
+enum DeathCauseBits : uint8_t {
+    kDeathStarvation = 1 << 0,
+    kDeathIllness    = 1 << 1,
+    kDeathOldAge     = 1 << 2,
+};
+
+// 批量更新的输出：死亡个体在组件池中的索引（升序）及其原因位
+struct DyingList {
+    std::vector<uint32_t> indices;
+    std::vector<uint8_t>  causes;
+
+    void clear() {
+        indices.clear();
+        causes.clear();
+    }
+
+    size_t size() const { return indices.size(); }
+};
+
+// 更新 data[0..count) 的年龄和饥饿度，并收集死亡个体
+// 无人死亡时每组只需一次掩码判断
+void update_and_collect(component::Lifecycle* data, size_t count, float dt, DyingList& out);
+
+// 计算单个个体的死亡原因位（0表示存活）
+uint8_t death_causes(const component::Lifecycle& life);
+
+// 按优先级（饥饿 > 疾病 > 衰老）选出死亡原因
+core::Symbol death_cause(uint8_t causes);
+
+// 按线性规律把Lifecycle推进elapsed天（与批量内核同一模型）
+component::Lifecycle project(const component::Lifecycle& life, double elapsed);
+
+// 从life开始、按当前模型最早满足死亡条件所需的天数（0表示已满足）
+double time_until_death(const component::Lifecycle& life);
+
+// 饥饿度越过kHungryThreshold所需的天数（已越过返回负数）
+double time_until_hungry(const component::Lifecycle& life);
+
+} // namespace process::lifecycle
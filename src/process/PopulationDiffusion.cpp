@@ -0,0 +1,159 @@
+#include "PopulationDiffusion.h"
+#include "PopulationDynamics.h"
+#include <algorithm>
+#include <cmath>
+
+namespace process::dynamics {
+
+namespace {
+
+// 温度适应度：最适温度为1，偏离超过耐受范围为0
+double temperature_fit(const Region& region, const SpeciesTemplate& species) {
+    if (species.temperature_tolerance <= 0.0f) {
+        return 1.0;
+    }
+    double deviation = std::abs(region.temperature - species.optimal_temperature);
+    return std::max(0.0, 1.0 - deviation / species.temperature_tolerance);
+}
+
+} // namespace
+
+void PopulationDiffusion::build_graph(const SimulationState& state) {
+    const auto& regions = state.get_all_regions();
+
+    region_ids_.clear();
+    for (const auto& [id, region] : regions) {
+        region_ids_.push_back(id);  // std::map有序，可二分查找
+    }
+
+    row_ptr_.assign(1, 0);
+    col_idx_.clear();
+    for (const auto& [id, region] : regions) {
+        for (uint32_t neighbor : region.neighbors) {
+            auto it = std::lower_bound(region_ids_.begin(), region_ids_.end(), neighbor);
+            if (it != region_ids_.end() && *it == neighbor && neighbor != id) {
+                col_idx_.push_back(static_cast<uint32_t>(it - region_ids_.begin()));
+            }
+        }
+        row_ptr_.push_back(static_cast<uint32_t>(col_idx_.size()));
+    }
+
+    species_count_ = state.get_all_species_templates().size();
+    topology_version_ = state.get_topology_version();
+    carry_.assign(region_ids_.size() * species_count_, 0.0);
+}
+
+void PopulationDiffusion::spmv(const double* x, double* y) const {
+    const size_t S = species_count_;
+    for (size_t j = 0; j + 1 < row_ptr_.size(); ++j) {
+        double* yj = y + j * S;
+        std::fill(yj, yj + S, 0.0);
+        for (uint32_t e = row_ptr_[j]; e < row_ptr_[j + 1]; ++e) {
+            const double* xi = x + static_cast<size_t>(col_idx_[e]) * S;
+            for (size_t s = 0; s < S; ++s) {
+                yj[s] += xi[s];
+            }
+        }
+    }
+}
+
+void PopulationDiffusion::execute(ProcessContext& ctx, float dt) {
+    last_migrants_ = 0.0;
+    if (!is_enabled() || dt <= 0.0f) {
+        return;
+    }
+
+    const auto& state = ctx.get_state();
+    const auto& species_list = state.get_all_species_templates();
+    if (topology_version_ != state.get_topology_version() ||
+        region_ids_.size() != state.get_all_regions().size() || species_count_ != species_list.size()) {
+        build_graph(state);
+    }
+
+    const size_t S = species_count_;
+    const size_t cells = region_ids_.size() * S;
+    pop_ids_.assign(cells, 0);
+    count_.assign(cells, 0.0);
+    weight_.assign(cells, 0.0);
+    outflow_.assign(cells, 0.0);
+    weight_sum_.resize(cells);
+    source_.resize(cells);
+    inflow_.resize(cells);
+
+    // 1. 收集参与迁移的种群
+    for (EntityId pop_id : ctx.get_registry().view<component::Population>()) {
+        const auto& pop = ctx.get<component::Population>(pop_id);
+        if (pop.mode != component::Population::Mode::Simulated) {
+            continue;
+        }
+
+        auto region_it = std::lower_bound(region_ids_.begin(), region_ids_.end(), pop.region_id);
+        auto species_it = std::find_if(species_list.begin(), species_list.end(),
+                                       [&](const SpeciesTemplate& s) { return s.id == pop.species_id; });
+        if (region_it == region_ids_.end() || *region_it != pop.region_id || species_it == species_list.end()) {
+            continue;
+        }
+
+        size_t cell = static_cast<size_t>(region_it - region_ids_.begin()) * S
+                    + static_cast<size_t>(species_it - species_list.begin());
+        pop_ids_[cell] = pop_id;
+        count_[cell] = static_cast<double>(pop.estimated_count);
+    }
+
+    // 2. 每个格子的离开率和作为目的地的权重
+    const double max_outflow = std::clamp(static_cast<double>(config_.max_outflow), 0.0, 1.0);
+    for (size_t r = 0; r < region_ids_.size(); ++r) {
+        const Region& region = state.get_all_regions().at(region_ids_[r]);
+        for (size_t s = 0; s < S; ++s) {
+            size_t cell = r * S + s;
+            if (pop_ids_[cell] == 0) {
+                continue;
+            }
+
+            const auto& species = species_list[s];
+            double K = species.food_requirement > 0.0f
+                ? static_cast<double>(region.current_food / species.food_requirement) : 0.0;
+            double crowding = K > 0.0 ? std::min(count_[cell] / K, 2.0) : 2.0;
+            double fit = temperature_fit(region, species);
+
+            double leave = config_.rate * dt * crowding * (2.0 - fit);
+            outflow_[cell] = std::min(leave, max_outflow) * count_[cell];
+            weight_[cell] = fit * std::max(0.0, 1.0 - crowding);
+        }
+    }
+
+    // 3. 源格子的归一化流出：out_i / Σ_{k∈nbr(i)} w_k（没有可去的邻居则不迁出）
+    spmv(weight_.data(), weight_sum_.data());
+    for (size_t cell = 0; cell < cells; ++cell) {
+        if (weight_sum_[cell] > 0.0) {
+            source_[cell] = outflow_[cell] / weight_sum_[cell];
+        } else {
+            source_[cell] = 0.0;
+            outflow_[cell] = 0.0;
+        }
+    }
+
+    // 4. 流入：in_j = w_j * Σ_{i∈nbr(j)} source_i
+    spmv(source_.data(), inflow_.data());
+
+    // 5. 写回（零头累积到下一步）
+    for (size_t cell = 0; cell < cells; ++cell) {
+        EntityId pop_id = pop_ids_[cell];
+        if (pop_id == 0) {
+            carry_[cell] = 0.0;
+            continue;
+        }
+
+        last_migrants_ += outflow_[cell];
+
+        double delta = weight_[cell] * inflow_[cell] - outflow_[cell] + carry_[cell];
+        double target = std::max(0.0, count_[cell] + std::round(delta));
+        carry_[cell] = delta - (target - count_[cell]);
+
+        // 迁移只移动整数个个体，增长积分的零头仍属于该种群（灭绝时清零）
+        auto& pop = ctx.get<component::Population>(pop_id);
+        commit_count(ctx, pop_id, pop, static_cast<uint32_t>(target), target > 0.0 ? pop.count_remainder : 0.0f);
+    }
+}
+
+} // namespace process::dynamics
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ProcessContext.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// LQ种群迁移（Region邻接图上的扩散）
+// 所有Region × 物种的数量排成稠密矩阵 N（行=Region，列=物种），
+// Region邻接关系存为CSR，每步用同一张图对所有物种一次完成稀疏矩阵乘：
+//   离开率   leave_i = rate * dt * min(N_i/K_i, 2) * (2 - fit_i)     （拥挤、温度不适时外迁）
+//   目的权重 w_j     = fit_j * max(0, 1 - N_j/K_j)                   （温度适宜、有余量的邻居）
+//   流出     out_i   = leave_i * N_i                                  （没有可去的邻居时为0）
+//   流入     in_j    = w_j * Σ_{i∈nbr(j)} out_i / Σ_{k∈nbr(i)} w_k
+// K为实时食物决定的承载力（current_food / food_requirement）。总量守恒；数量取整的零头按(Region, 物种)累积到下一步。
+// 只有Simulated模式（LQ/MQ）的种群参与，HQ和转换中的种群既不迁出也不迁入；
+// 没有该物种种群的Region视为不可达（不会凭空创建种群）。
+// ============================================================
+
+namespace process::dynamics {
+
+class PopulationDiffusion {
+public:
+    struct Config {
+        float rate = 0.0f;         // 完全拥挤时每天的外迁比例（0表示禁用）
+        float max_outflow = 0.5f;  // 每步最多迁出的比例
+    };
+
+    void set_config(const Config& config) { config_ = config; }
+    const Config& get_config() const { return config_; }
+    bool is_enabled() const { return config_.rate > 0.0f; }
+
+    // 推进dt时间的迁移，写回种群数量并记录Effect
+    void execute(ProcessContext& ctx, float dt);
+
+    // 上一步迁移的个体总数（连续值）
+    double get_last_migrants() const { return last_migrants_; }
+
+private:
+    // 邻接关系、Region数或物种数变化时重建CSR邻接图
+    void build_graph(const SimulationState& state);
+
+    // y[j, :] = Σ_{i∈nbr(j)} x[i, :]（一次遍历CSR，内层循环覆盖所有物种）
+    void spmv(const double* x, double* y) const;
+
+    Config config_;
+    double last_migrants_ = 0.0;
+
+    // CSR邻接图（下标为region_ids_中的位置）
+    std::vector<uint32_t> region_ids_;
+    std::vector<uint32_t> row_ptr_;
+    std::vector<uint32_t> col_idx_;
+    size_t species_count_ = 0;
+    uint32_t topology_version_ = 0;
+
+    // 稠密状态（Region数 × 物种数，行优先），跨步复用
+    std::vector<EntityId> pop_ids_;  // 0 = 不参与
+    std::vector<double> count_;
+    std::vector<double> weight_;     // w
+    std::vector<double> weight_sum_; // Σ邻居w
+    std::vector<double> source_;     // out_i / Σ邻居w
+    std::vector<double> outflow_;
+    std::vector<double> inflow_;
+    std::vector<double> carry_;      // 取整零头
+};
+
+} // namespace process::dynamics
@@ -0,0 +1,195 @@
+#include "PopulationDynamics.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace process::dynamics {
+
+bool RegionBatch::has_active_predation() const {
+    for (const auto& link : predation) {
+        if (simulated[link.prey] && count[link.predator] > 0.0 && link.efficiency > 0.0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace {
+
+void append_population(RegionBatch& batch, EntityId pop_id, const component::Population& pop,
+                       const Region& region, const SpeciesTemplate& species) {
+    batch.pop_ids.push_back(pop_id);
+    batch.count.push_back(std::max(0.0, static_cast<double>(pop.estimated_count) + pop.count_remainder));
+    batch.r.push_back(static_cast<double>(pop.birth_rate - pop.death_rate));
+    batch.K.push_back(static_cast<double>(region.current_food / species.food_requirement));
+    batch.simulated.push_back(pop.mode == component::Population::Mode::Simulated ? 1 : 0);
+}
+
+// 根据batch内各种群的物种建立捕食关系
+void link_predation(ProcessContext& ctx, RegionBatch& batch) {
+    batch.predation.clear();
+
+    for (uint32_t j = 0; j < batch.size(); ++j) {
+        SpeciesId predator_species_id = ctx.get<component::Population>(batch.pop_ids[j]).species_id;
+        auto predator_result = ctx.get_species_template(predator_species_id);
+        if (predator_result.is_err()) {
+            continue;
+        }
+        const auto& predator = predator_result.value().get();
+
+        for (SpeciesId prey_species : predator.prey_species) {
+            for (uint32_t i = 0; i < batch.size(); ++i) {
+                if (ctx.get<component::Population>(batch.pop_ids[i]).species_id == prey_species) {
+                    batch.predation.push_back(PredationLink{j, i, predator.hunt_efficiency});
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+bool build_region_batch(ProcessContext& ctx, uint32_t region_id, RegionBatch& out) {
+    out = RegionBatch{};
+    out.region_id = region_id;
+
+    auto region_result = ctx.get_region(region_id);
+    if (region_result.is_err()) {
+        return false;
+    }
+    const auto& region = region_result.value().get();
+
+    const auto& all_pops = ctx.get_registry().view<component::Population>();
+
+    for (EntityId pop_id : all_pops) {
+        const auto& pop = ctx.get<component::Population>(pop_id);
+        if (pop.region_id != region_id) {
+            continue;
+        }
+
+        auto species_result = ctx.get_species_template(pop.species_id);
+        if (species_result.is_err()) {
+            continue;
+        }
+        append_population(out, pop_id, pop, region, species_result.value().get());
+    }
+
+    link_predation(ctx, out);
+    return !out.pop_ids.empty();
+}
+
+void build_region_batches(ProcessContext& ctx, std::vector<RegionBatch>& out) {
+    out.clear();
+    std::unordered_map<uint32_t, size_t> batch_index;
+
+    const auto& all_pops = ctx.get_registry().view<component::Population>();
+
+    for (EntityId pop_id : all_pops) {
+        const auto& pop = ctx.get<component::Population>(pop_id);
+
+        auto region_result = ctx.get_region(pop.region_id);
+        auto species_result = ctx.get_species_template(pop.species_id);
+        if (region_result.is_err() || species_result.is_err()) {
+            continue;
+        }
+
+        auto [it, inserted] = batch_index.try_emplace(pop.region_id, out.size());
+        if (inserted) {
+            out.emplace_back();
+            out.back().region_id = pop.region_id;
+        }
+        append_population(out[it->second], pop_id, pop,
+                          region_result.value().get(), species_result.value().get());
+    }
+
+    // 去掉没有LQ种群的Region（HQ区域不参与积分）
+    out.erase(std::remove_if(out.begin(), out.end(), [](const RegionBatch& batch) {
+        return std::none_of(batch.simulated.begin(), batch.simulated.end(),
+                            [](uint8_t s) { return s != 0; });
+    }), out.end());
+
+    for (auto& batch : out) {
+        link_predation(ctx, batch);
+    }
+}
+
+void store_count(component::Population& pop, uint32_t count, float remainder) {
+    pop.estimated_count = count;
+    pop.count_remainder = remainder;
+}
+
+void commit_count(ProcessContext& ctx, EntityId pop_id, component::Population& pop, uint32_t new_count,
+                  float remainder) {
+    uint32_t old_count = pop.estimated_count;
+    store_count(pop, new_count, remainder);
+
+    if (pop.estimated_count != old_count) {
+        ctx.record(effect::ResourceChanged{
+            pop_id,
+            core::sym::EstimatedCount,
+            static_cast<float>(old_count),
+            static_cast<float>(pop.estimated_count)
+        });
+    }
+
+    // 检查灭绝
+    if (pop.estimated_count == 0 && old_count > 0) {
+        ctx.record(effect::Death{pop_id, core::sym::PopulationExtinction});
+    }
+}
+
+void commit_batch(ProcessContext& ctx, const RegionBatch& batch) {
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (!batch.simulated[i]) {
+            continue;
+        }
+        auto& pop = ctx.get<component::Population>(batch.pop_ids[i]);
+        double value = std::max(0.0, batch.count[i]);
+        double rounded = std::round(value);
+
+        // 保留零头供下一步继续积分；灭绝后清零，避免从零头中复活
+        float remainder = rounded > 0.0 ? static_cast<float>(value - rounded) : 0.0f;
+        commit_count(ctx, batch.pop_ids[i], pop, static_cast<uint32_t>(rounded), remainder);
+    }
+}
+
+void derivative(const RegionBatch& batch, const double* N, double* dNdt) {
+    const size_t n = batch.size();
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!batch.simulated[i]) {
+            dNdt[i] = 0.0;
+            continue;
+        }
+        double logistic_factor = std::max(0.0, 1.0 - N[i] / batch.K[i]);
+        dNdt[i] = batch.r[i] * logistic_factor * N[i];
+    }
+
+    for (const auto& link : batch.predation) {
+        if (batch.simulated[link.prey]) {
+            dNdt[link.prey] -= N[link.predator] * link.efficiency;
+        }
+    }
+
+    // 数量为0时不再减少
+    for (size_t i = 0; i < n; ++i) {
+        if (N[i] <= 0.0 && dNdt[i] < 0.0) {
+            dNdt[i] = 0.0;
+        }
+    }
+}
+
+double logistic_closed_form(double N0, double r, double K, double t) {
+    if (N0 <= 0.0 || K <= 0.0) {
+        return std::max(0.0, N0);
+    }
+    // 超过承载力时增长因子截断为0
+    if (N0 >= K) {
+        return N0;
+    }
+
+    // N(t) = K / (1 + (K/N0 - 1) * e^{-rt})
+    return K / (1.0 + (K / N0 - 1.0) * std::exp(-r * t));
+}
+
+} // namespace process::dynamics
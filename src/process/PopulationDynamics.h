@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ProcessContext.h"
+#include "components/Components.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// 种群动力学（批量形式）
+// 把一个Region内的所有种群组织成状态向量 N，
+// 与UpdatePopulationGrowth使用同一模型：
+//   dN_i/dt = r_i * N_i * max(0, 1 - N_i/K_i) - Σ_j N_j * hunt_efficiency_j
+// （j 为捕食 i 的种群）
+// ============================================================
+
+namespace process::dynamics {
+
+// 捕食关系：predator 和 prey 为 RegionBatch 内的下标
+struct PredationLink {
+    uint32_t predator;
+    uint32_t prey;
+    double efficiency;
+};
+
+// 一个Region的种群批量状态
+struct RegionBatch {
+    uint32_t region_id = 0;
+
+    std::vector<EntityId> pop_ids;
+    std::vector<double> count;     // N（连续值）
+    std::vector<double> r;         // birth_rate - death_rate
+    std::vector<double> K;         // 承载力 current_food / food_requirement
+    std::vector<uint8_t> simulated; // 1 = LQ模式参与积分；0 = HQ种群，数量视为常数
+
+    std::vector<PredationLink> predation;
+
+    size_t size() const { return pop_ids.size(); }
+
+    // 是否存在作用于LQ种群的捕食（决定能否使用解析解）
+    bool has_active_predation() const;
+};
+
+// 收集Region内的所有种群，构建批量状态
+bool build_region_batch(ProcessContext& ctx, uint32_t region_id, RegionBatch& out);
+
+// 单次遍历所有种群，为每个含LQ种群的Region构建批量状态
+void build_region_batches(ProcessContext& ctx, std::vector<RegionBatch>& out);
+
+// 把批量状态中LQ种群的数量写回Population组件（四舍五入，零头存入count_remainder），并记录Effect
+// build_region_batch从 estimated_count + count_remainder 恢复连续状态
+void commit_batch(ProcessContext& ctx, const RegionBatch& batch);
+
+// 设置种群数量及其零头（所有对estimated_count的写入都经过这里；
+// 非批量积分的写入零头为0，避免下一次批量积分把属于旧数量的零头加回来）
+void store_count(component::Population& pop, uint32_t count, float remainder = 0.0f);
+
+// 写回单个种群的数量和零头并记录Effect（数量变化、灭绝）
+void commit_count(ProcessContext& ctx, EntityId pop_id, component::Population& pop, uint32_t new_count,
+                  float remainder = 0.0f);
+
+// 计算 dN/dt（N 为状态向量，长度等于 batch.size()）
+void derivative(const RegionBatch& batch, const double* N, double* dNdt);
+
+// Logistic方程的解析解（与模型一致：N >= K 时增长因子截断为0，数量保持不变）
+double logistic_closed_form(double N0, double r, double K, double t);
+
+} // namespace process::dynamics
@@ -2,7 +2,9 @@
 
 #include "ecs/Registry.h"
 #include "EffectRecorder.h"
+#include "GeneStatistics.h"
 #include "simulation/SimulationState.h"
+#include <vector>
 
 // ============================================================
 // ProcessContext - Process执行上下文
@@ -30,9 +32,10 @@ public:
         return registry_.has_component<C>(id);
     }
 
-    // Effect记录
-    void record(effect::Effect&& e) {
-        recorder_.record(std::move(e));
+    // Effect记录（具体Effect类型或effect::Effect变体）
+    template<typename E>
+    void record(const E& e) {
+        recorder_.record(e);
     }
 
     // 世界状态访问 (返回 Result 以处理错误)
@@ -41,7 +44,7 @@ public:
     }
 
     core::Result<core::RefWrapper<const Region>, core::ErrorCode> get_region(uint32_t id) const {
-        return state_.get_region(id);
+        return static_cast<const SimulationState&>(state_).get_region(id);
     }
 
     core::Result<core::RefWrapper<const SpeciesTemplate>, core::ErrorCode>
@@ -56,16 +59,59 @@ public:
     // Entity创建（立即创建，不延迟）
     EntityId create_entity(EntityType type) {
         EntityId id = registry_.create_entity(type);
-        recorder_.record(effect::EntityCreated{id, type, ""});
+        recorder_.record(effect::EntityCreated{id, type, core::sym::None});
         return id;
     }
 
-    // Entity销毁
-    void destroy_entity(EntityId id, const std::string& reason) {
+    // 以原ID重新创建已销毁的Entity（ID单调递增、不会复用）
+    void restore_entity(EntityId id, EntityType type, core::Symbol description) {
+        registry_.create_entity_with_id(id, type);
+        recorder_.record(effect::EntityCreated{id, type, description});
+    }
+
+    // Entity销毁（个体同时从基因统计中移除）
+    void destroy_entity(EntityId id, core::Symbol reason) {
+        untrack_creature(id);
         recorder_.record(effect::EntityDestroyed{id, reason});
         registry_.destroy_entity(id);
     }
 
+    // 个体组件添加完成后登记到基因统计（生成/恢复个体时调用）
+    void track_creature(EntityId id) {
+        if (is_tracked_creature(id)) {
+            gene_stats_.add(get<component::Position>(id).region_id,
+                            get<component::SpeciesRef>(id).species_id,
+                            get<component::GameplayGene>(id).gene);
+        }
+    }
+
+    // 个体在Region间移动（在修改Position之前调用）
+    void move_creature(EntityId id, uint32_t to_region) {
+        if (is_tracked_creature(id)) {
+            gene_stats_.move(get<component::Position>(id).region_id, to_region,
+                             get<component::SpeciesRef>(id).species_id,
+                             get<component::GameplayGene>(id).gene);
+        }
+    }
+
+    // 延迟销毁（批量Process遍历组件池期间不能直接销毁，由flush_deferred_destroys统一执行）
+    void defer_destroy(EntityId id, core::Symbol reason) {
+        deferred_destroys_.push_back({id, reason});
+    }
+
+    void flush_deferred_destroys() {
+        for (const auto& pending : deferred_destroys_) {
+            destroy_entity(pending.id, pending.reason);
+        }
+        deferred_destroys_.clear();
+    }
+
+    // EffectRecorder访问（用于归并分片Effect）
+    ecs::EffectRecorder& get_recorder() { return recorder_; }
+
+    // 按(Region, 物种)增量维护的存活个体基因统计
+    const process::GeneStatistics& get_gene_stats() const { return gene_stats_; }
+
     // Registry访问（用于批量查询）
     ecs::Registry& get_registry() { return registry_; }
     const ecs::Registry& get_registry() const { return registry_; }
@@ -75,7 +121,28 @@ public:
     const SimulationState& get_state() const { return state_; }
 
 private:
+    bool is_tracked_creature(EntityId id) const {
+        return has<component::Position>(id) && has<component::SpeciesRef>(id)
+            && has<component::GameplayGene>(id);
+    }
+
+    void untrack_creature(EntityId id) {
+        if (is_tracked_creature(id)) {
+            gene_stats_.remove(get<component::Position>(id).region_id,
+                               get<component::SpeciesRef>(id).species_id,
+                               get<component::GameplayGene>(id).gene);
+        }
+    }
+
     ecs::Registry& registry_;
     ecs::EffectRecorder& recorder_;
     SimulationState& state_;
+
+    struct PendingDestroy {
+        EntityId id;
+        core::Symbol reason;
+    };
+    std::vector<PendingDestroy> deferred_destroys_;
+
+    process::GeneStatistics gene_stats_;
 };
@@ -0,0 +1,244 @@
+#include "ProcessRuntime.h"
+#include <algorithm>
+#include <new>
+#include <tuple>
+
+namespace process::co {
+
+// ========== FramePool ==========
+
+void* FramePool::allocate(size_t size) {
+    size_t cls = (size + kGranularity - 1) / kGranularity;
+    if (cls == 0 || cls > kClasses) {
+        return ::operator new(size);
+    }
+
+    FreeNode*& head = free_lists_[cls - 1];
+    if (!head) {
+        // 一次切出一整块，串成空闲链表
+        const size_t block = cls * kGranularity;
+        auto chunk = std::make_unique<std::byte[]>(block * kBlocksPerChunk);
+        for (size_t i = 0; i < kBlocksPerChunk; ++i) {
+            auto* node = reinterpret_cast<FreeNode*>(chunk.get() + i * block);
+            node->next = head;
+            head = node;
+        }
+        chunks_.push_back(std::move(chunk));
+        reserved_bytes_ += block * kBlocksPerChunk;
+    }
+
+    FreeNode* node = head;
+    head = node->next;
+    ++live_frames_;
+    return node;
+}
+
+void FramePool::deallocate(void* ptr, size_t size) {
+    size_t cls = (size + kGranularity - 1) / kGranularity;
+    if (cls == 0 || cls > kClasses) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    auto* node = static_cast<FreeNode*>(ptr);
+    node->next = free_lists_[cls - 1];
+    free_lists_[cls - 1] = node;
+    --live_frames_;
+}
+
+FramePool& FramePool::local() {
+    thread_local FramePool pool;
+    return pool;
+}
+
+// ========== SimTask ==========
+
+SimTask& SimTask::operator=(SimTask&& other) noexcept {
+    if (this != &other) {
+        if (handle_) {
+            handle_.destroy();
+        }
+        handle_ = other.handle_;
+        other.handle_ = nullptr;
+    }
+    return *this;
+}
+
+SimTask::~SimTask() {
+    // 未交给运行时的协程（从未启动）在这里销毁
+    if (handle_) {
+        handle_.destroy();
+    }
+}
+
+// ========== 等待器 ==========
+
+void DelayAwaiter::await_suspend(SimTask::Handle handle) {
+    ProcessRuntime* runtime = handle.promise().runtime;
+    runtime->suspend_until(handle, runtime->now_ + days);
+}
+
+void EventAwaiter::await_suspend(SimTask::Handle handle) {
+    handle.promise().runtime->suspend_on(handle, key);
+}
+
+// ========== ProcessRuntime ==========
+
+ProcessRuntime::ProcessRuntime(double resolution)
+    : timers_(resolution) {
+}
+
+ProcessRuntime::~ProcessRuntime() {
+    for (auto& [id, slot] : tasks_) {
+        slot.handle.destroy();
+    }
+}
+
+TaskId ProcessRuntime::spawn(SimTask task) {
+    SimTask::Handle handle = task.release();
+    TaskId id = next_task_id_++;
+
+    handle.promise().runtime = this;
+    handle.promise().id = id;
+    tasks_.emplace(id, TaskSlot{handle});
+
+    // 执行到第一个挂起点
+    resume(Waiter{id, 0});
+    return id;
+}
+
+bool ProcessRuntime::cancel(TaskId id) {
+    auto it = tasks_.find(id);
+    if (it == tasks_.end() || it->second.cancelled) {
+        return false;
+    }
+    TaskSlot& slot = it->second;
+
+    // 事件等待记录直接移除（事件可能永远不触发）；定时器中残留的记录在到期时按ID/序号失效
+    remove_event_waiter(id, slot);
+    ++slot.wait_seq;
+
+    // 帧正在执行：resume返回后销毁
+    if (slot.running) {
+        slot.cancelled = true;
+        ++cancelled_running_;
+        return true;
+    }
+
+    slot.handle.destroy();
+    tasks_.erase(it);
+    return true;
+}
+
+bool ProcessRuntime::is_alive(TaskId id) const {
+    auto it = tasks_.find(id);
+    return it != tasks_.end() && !it->second.cancelled;
+}
+
+void ProcessRuntime::remove_event_waiter(TaskId id, const TaskSlot& slot) {
+    if (!slot.waiting_event) {
+        return;
+    }
+    auto it = event_waiters_.find(slot.event);
+    if (it == event_waiters_.end()) {
+        return;
+    }
+
+    auto& waiters = it->second;
+    waiters.erase(std::remove_if(waiters.begin(), waiters.end(), [&](const Waiter& w) {
+        return w.id == id && w.wait_seq == slot.wait_seq;
+    }), waiters.end());
+    if (waiters.empty()) {
+        event_waiters_.erase(it);
+    }
+}
+
+void ProcessRuntime::signal(EventKey key) {
+    auto it = event_waiters_.find(key);
+    if (it == event_waiters_.end()) {
+        return;
+    }
+    ready_.insert(ready_.end(), it->second.begin(), it->second.end());
+    event_waiters_.erase(it);
+}
+
+size_t ProcessRuntime::advance(double dt) {
+    now_ += dt;
+    resumed_last_step_ = 0;
+
+    // 1. 事件已触发的协程（按触发顺序）
+    ready_scratch_.clear();
+    ready_scratch_.swap(ready_);
+    for (const auto& waiter : ready_scratch_) {
+        if (resume(waiter)) {
+            ++resumed_last_step_;
+        }
+    }
+
+    // 2. 定时器到期的协程（同一步内按到期时间、任务ID排序，保证确定性）
+    fired_.clear();
+    timers_.advance(now_, fired_);
+    std::sort(fired_.begin(), fired_.end(), [](const auto& a, const auto& b) {
+        return std::tie(a.due_time, a.payload.id) < std::tie(b.due_time, b.payload.id);
+    });
+
+    for (const auto& entry : fired_) {
+        // tick粒度内尚未真正到期，留到下一tick
+        if (entry.due_time > now_) {
+            timers_.schedule(entry.due_time, entry.payload);
+            continue;
+        }
+        if (resume(entry.payload)) {
+            ++resumed_last_step_;
+        }
+    }
+
+    return resumed_last_step_;
+}
+
+void ProcessRuntime::suspend_until(SimTask::Handle handle, double due_time) {
+    auto& slot = tasks_.at(handle.promise().id);
+    if (slot.cancelled) {
+        return;  // resume返回后销毁
+    }
+    ++slot.wait_seq;
+    slot.waiting_event = false;
+    timers_.schedule(due_time, Waiter{handle.promise().id, slot.wait_seq});
+}
+
+void ProcessRuntime::suspend_on(SimTask::Handle handle, EventKey key) {
+    auto& slot = tasks_.at(handle.promise().id);
+    if (slot.cancelled) {
+        return;
+    }
+    ++slot.wait_seq;
+    slot.event = key;
+    slot.waiting_event = true;
+    event_waiters_[key].push_back(Waiter{handle.promise().id, slot.wait_seq});
+}
+
+bool ProcessRuntime::resume(const Waiter& waiter) {
+    auto it = tasks_.find(waiter.id);
+    if (it == tasks_.end() || it->second.wait_seq != waiter.wait_seq) {
+        return false;
+    }
+
+    SimTask::Handle handle = it->second.handle;
+    it->second.running = true;
+    it->second.waiting_event = false;
+    handle.resume();
+
+    // 恢复期间可能spawn了新任务导致表重排，重新查找
+    it = tasks_.find(waiter.id);
+    it->second.running = false;
+    if (it->second.cancelled) {
+        --cancelled_running_;
+    }
+    if (handle.done() || it->second.cancelled) {
+        handle.destroy();
+        tasks_.erase(it);
+    }
+    return true;
+}
+
+} // namespace process::co
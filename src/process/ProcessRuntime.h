@@ -0,0 +1,207 @@
+#pragma once
+
+#include "TimingWheel.h"
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================
+// 长期运行Process的协程运行时（Buff / CraftJob / Wait / ScheduleNextEvent）
+// 一个长期Process写成一个协程：
+//
+//   co::SimTask TickBuff(ProcessContext& ctx, EntityId target, int ticks) {
+//       for (int i = 0; i < ticks; ++i) {
+//           co_await co::delay(1.0);           // 挂起1天模拟时间
+//           ctx.record(effect::ResourceChanged{...});
+//       }
+//   }
+//
+// 挂起的协程帧来自FramePool，定时器挂在时间轮上；
+// 每步只恢复定时器到期或等待事件已触发的协程，休眠的协程没有逐帧开销。
+// ============================================================
+
+namespace process::co {
+
+using TaskId = uint64_t;
+using EventKey = uint64_t;
+
+class ProcessRuntime;
+
+// ========== 协程帧池 ==========
+// 按64字节分级的空闲链表，帧大小超过上限时回退到全局operator new
+class FramePool {
+public:
+    FramePool() = default;
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    void* allocate(size_t size);
+    void deallocate(void* ptr, size_t size);
+
+    // 当前线程的帧池（协程帧在创建它的线程上释放）
+    static FramePool& local();
+
+    size_t get_live_frames() const { return live_frames_; }
+    size_t get_reserved_bytes() const { return reserved_bytes_; }
+
+private:
+    static constexpr size_t kGranularity = 64;
+    static constexpr size_t kClasses = 32;          // 最大 64 * 32 = 2KB
+    static constexpr size_t kBlocksPerChunk = 64;
+
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    FreeNode* free_lists_[kClasses] = {};
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+    size_t live_frames_ = 0;
+    size_t reserved_bytes_ = 0;
+};
+
+// ========== 协程返回类型 ==========
+class SimTask {
+public:
+    struct promise_type {
+        ProcessRuntime* runtime = nullptr;
+        TaskId id = 0;
+
+        SimTask get_return_object() {
+            return SimTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        // 创建后挂起，由ProcessRuntime::spawn首次恢复
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        // 结束后挂起，由运行时统一销毁
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+
+        // Process不使用异常传递错误
+        void unhandled_exception() { std::terminate(); }
+
+        static void* operator new(size_t size) { return FramePool::local().allocate(size); }
+        static void operator delete(void* ptr, size_t size) { FramePool::local().deallocate(ptr, size); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    SimTask(SimTask&& other) noexcept : handle_(other.handle_) { other.handle_ = nullptr; }
+    SimTask& operator=(SimTask&& other) noexcept;
+    SimTask(const SimTask&) = delete;
+    SimTask& operator=(const SimTask&) = delete;
+    ~SimTask();
+
+    // 交出协程句柄的所有权（由运行时接管）
+    Handle release() {
+        Handle h = handle_;
+        handle_ = nullptr;
+        return h;
+    }
+
+private:
+    explicit SimTask(Handle handle) : handle_(handle) {}
+
+    Handle handle_;
+};
+
+// ========== 等待器 ==========
+
+// co_await delay(days)：挂起指定的模拟时间（<=0 时在下一步恢复）
+struct DelayAwaiter {
+    double days;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(SimTask::Handle handle);
+    void await_resume() const noexcept {}
+};
+
+// co_await wait_event(key)：挂起直到ProcessRuntime::signal(key)
+struct EventAwaiter {
+    EventKey key;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(SimTask::Handle handle);
+    void await_resume() const noexcept {}
+};
+
+inline DelayAwaiter delay(double days) { return DelayAwaiter{days}; }
+inline EventAwaiter wait_event(EventKey key) { return EventAwaiter{key}; }
+
+// ========== 运行时 ==========
+class ProcessRuntime {
+public:
+    explicit ProcessRuntime(double resolution = 0.1);
+    ~ProcessRuntime();
+
+    ProcessRuntime(const ProcessRuntime&) = delete;
+    ProcessRuntime& operator=(const ProcessRuntime&) = delete;
+
+    // 启动协程：立即执行到第一个co_await，返回任务ID（协程已结束时仍返回有效ID）
+    TaskId spawn(SimTask task);
+
+    // 取消任务（销毁协程帧，挂起的定时器/事件等待随之作废）
+    // 正在执行的任务（取消自身，或取消恢复栈上等待嵌套spawn返回的任务）只做标记，
+    // 协程继续执行到下一个挂起点，resume返回后再销毁
+    bool cancel(TaskId id);
+
+    // 触发事件：等待该事件的协程在下一次advance开始时恢复
+    void signal(EventKey key);
+
+    // 推进模拟时间dt：先恢复事件已触发的协程，再恢复定时器到期的协程
+    // 返回本步恢复的协程数
+    size_t advance(double dt);
+
+    double get_time() const { return now_; }
+    bool is_alive(TaskId id) const;
+    size_t get_live_tasks() const { return tasks_.size() - cancelled_running_; }
+    size_t get_pending_timers() const { return timers_.size(); }
+    size_t get_resumed_last_step() const { return resumed_last_step_; }
+
+private:
+    friend struct DelayAwaiter;
+    friend struct EventAwaiter;
+
+    struct TaskSlot {
+        SimTask::Handle handle;
+        uint32_t wait_seq = 0;   // 每次挂起递增，用于识别过期的定时器/事件等待
+        EventKey event = 0;      // 最近一次等待的事件（取消时从等待表中移除）
+        bool waiting_event = false;
+        bool running = false;    // 在恢复栈上（帧不能销毁）
+        bool cancelled = false;  // 运行中被取消，resume返回后销毁
+    };
+
+    struct Waiter {
+        TaskId id;
+        uint32_t wait_seq;
+    };
+
+    void suspend_until(SimTask::Handle handle, double due_time);
+    void suspend_on(SimTask::Handle handle, EventKey key);
+
+    // 恢复一次等待，协程结束或运行中被取消时回收
+    bool resume(const Waiter& waiter);
+
+    // 从事件等待表中移除任务当前的等待记录
+    void remove_event_waiter(TaskId id, const TaskSlot& slot);
+
+    double now_ = 0.0;
+    TaskId next_task_id_ = 1;
+
+    std::unordered_map<TaskId, TaskSlot> tasks_;
+    TimingWheel<Waiter> timers_;
+    std::unordered_map<EventKey, std::vector<Waiter>> event_waiters_;
+
+    std::vector<Waiter> ready_;                         // 已触发事件的等待者
+    std::vector<Waiter> ready_scratch_;
+    std::vector<TimingWheel<Waiter>::Entry> fired_;     // 复用的到期定时器缓冲
+
+    size_t resumed_last_step_ = 0;
+    size_t cancelled_running_ = 0;   // 已取消、等待resume返回后销毁的任务数
+};
+
+} // namespace process::co
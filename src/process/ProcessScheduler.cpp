@@ -1,9 +1,15 @@
 #include "ProcessScheduler.h"
+#include <algorithm>
 #include <iostream>
 
 namespace process {
 
 void ProcessScheduler::execute_all_population_growth(float dt) {
+    if (pop_integrator_.get_mode() != dynamics::IntegratorMode::Euler) {
+        integrate_region_batches(dt, nullptr);
+        return;
+    }
+
     const auto& all_pops = ctx_.get_registry().view<component::Population>();
 
     for (EntityId pop_id : all_pops) {
@@ -11,30 +17,224 @@ void ProcessScheduler::execute_all_population_growth(float dt) {
     }
 }
 
+void ProcessScheduler::execute_population_growth_in_regions(const std::vector<RegionTick>& ticks) {
+    if (ticks.empty()) {
+        return;
+    }
+
+    region_dt_scratch_.clear();
+    for (const auto& tick : ticks) {
+        // 长时间未更新的Region直接快进，不参与逐步积分
+        if (fast_forward_threshold_ > 0.0f && tick.dt >= fast_forward_threshold_) {
+            fast_forward_region(tick.region_id, tick.dt);
+            continue;
+        }
+        region_dt_scratch_[tick.region_id] = tick.dt;
+    }
+
+    if (region_dt_scratch_.empty()) {
+        return;
+    }
+
+    if (pop_integrator_.get_mode() != dynamics::IntegratorMode::Euler) {
+        integrate_region_batches(0.0f, &region_dt_scratch_);
+        return;
+    }
+
+    // 单次遍历种群，跳过本步不更新的Region
+    const auto& all_pops = ctx_.get_registry().view<component::Population>();
+
+    for (EntityId pop_id : all_pops) {
+        const auto& pop = ctx_.get<component::Population>(pop_id);
+        auto it = region_dt_scratch_.find(pop.region_id);
+        if (it == region_dt_scratch_.end()) {
+            continue;
+        }
+        update_pop_growth_.execute(ctx_, pop_id, it->second);
+    }
+}
+
+void ProcessScheduler::integrate_region_batches(float dt, const std::unordered_map<uint32_t, float>* region_dts) {
+    dynamics::build_region_batches(ctx_, batches_scratch_);
+
+    for (auto& batch : batches_scratch_) {
+        float region_dt = dt;
+        if (region_dts) {
+            auto it = region_dts->find(batch.region_id);
+            if (it == region_dts->end()) {
+                continue;
+            }
+            region_dt = it->second;
+        }
+
+        pop_integrator_.integrate(batch, static_cast<double>(region_dt));
+        dynamics::commit_batch(ctx_, batch);
+    }
+}
+
+void ProcessScheduler::fast_forward_region(uint32_t region_id, float elapsed) {
+    fast_forward_.execute(ctx_, region_id, elapsed);
+}
+
 void ProcessScheduler::execute_all_creature_lifecycle(float dt) {
-    const auto& all_creatures = ctx_.get_registry().view<component::Lifecycle>();
+    if (lifecycle_mode_ == LifecycleMode::EventDriven) {
+        // 只处理本步到期的事件
+        lifecycle_events_.advance(ctx_, dt);
+    } else {
+        // 分块批量遍历Lifecycle组件池，屏障处按 系统→块→实体 归并Effect
+        process_lifecycle_.execute_batch(ctx_, dt, effect_shards_, &worker_pool_);
+        effect_shards_.merge_into(ctx_.get_recorder());
+    }
+    // 死亡个体在处理结束后统一销毁
+    ctx_.flush_deferred_destroys();
+}
 
-    for (EntityId creature_id : all_creatures) {
-        process_lifecycle_.execute(ctx_, creature_id, dt);
+void ProcessScheduler::execute_long_running_processes(float dt) {
+    runtime_.advance(dt);
+    // 协程中的死亡也走延迟销毁
+    ctx_.flush_deferred_destroys();
+}
+
+void ProcessScheduler::set_lifecycle_mode(LifecycleMode mode) {
+    if (mode == lifecycle_mode_) {
+        return;
+    }
+
+    if (mode == LifecycleMode::EventDriven) {
+        lifecycle_events_.track_all(ctx_);
+    } else {
+        lifecycle_events_.materialize_all(ctx_);
     }
+    // 批量改写Lifecycle/LifecycleSchedule没有逐个体的Effect，回放时由该Effect触发的关键帧恢复
+    ctx_.record(effect::RegionChanged{
+        0, core::sym::LifecycleMode, static_cast<float>(lifecycle_mode_), static_cast<float>(mode)
+    });
+    lifecycle_mode_ = mode;
 }
 
-void ProcessScheduler::convert_lq_to_hq(EntityId pop_id, uint32_t spawn_count) {
-    auto& pop = ctx_.get<component::Population>(pop_id);
+component::Lifecycle ProcessScheduler::get_creature_lifecycle(EntityId creature_id) const {
+    if (lifecycle_mode_ == LifecycleMode::EventDriven) {
+        return lifecycle_events_.current(ctx_, creature_id);
+    }
+    return ctx_.get<component::Lifecycle>(creature_id);
+}
 
-    if (pop.mode != component::Population::Mode::Simulated) {
+void ProcessScheduler::convert_lq_to_hq(EntityId pop_id, uint32_t spawn_count) {
+    if (ctx_.get<component::Population>(pop_id).mode != component::Population::Mode::Simulated) {
         std::cout << "[Scheduler] Population " << pop_id << " is already in HQ mode" << std::endl;
         return;
     }
 
+    begin_lq_to_hq(pop_id);
+    spawn_batch(pop_id, spawn_count);
+    finish_lq_to_hq(pop_id);
+}
+
+void ProcessScheduler::begin_lq_to_hq(EntityId pop_id) {
+    auto& pop = ctx_.get<component::Population>(pop_id);
+
     std::cout << "[Scheduler] Converting LQ→HQ: Population " << pop_id
               << " (species " << pop.species_id << ", region " << pop.region_id << ")" << std::endl;
 
-    // 1. 生成个体
-    spawn_creatures_.execute(ctx_, pop_id, spawn_count);
+    pop.mode = component::Population::Mode::Converting;
+    pop.individual_count = 0;
+}
+
+uint32_t ProcessScheduler::spawn_batch(EntityId pop_id, uint32_t count) {
+    // 先恢复休眠个体，不足的部分再按分布采样新个体（事件驱动模式下为新个体挂起生命周期事件）
+    spawned_scratch_.clear();
+    uint32_t restored = restore_dormant(pop_id, count);
+    if (restored < count) {
+        spawn_creatures_.execute(ctx_, pop_id, count - restored, &spawned_scratch_);
+    }
+
+    if (lifecycle_mode_ == LifecycleMode::EventDriven) {
+        for (EntityId creature_id : spawned_scratch_) {
+            lifecycle_events_.track(ctx_, creature_id);
+        }
+    }
+
+    return static_cast<uint32_t>(spawned_scratch_.size());
+}
 
-    // 2. 切换模式
+void ProcessScheduler::finish_lq_to_hq(EntityId pop_id) {
+    auto& pop = ctx_.get<component::Population>(pop_id);
     pop.mode = component::Population::Mode::DerivedFromIndividuals;
+
+    // 未恢复的休眠个体不再使用
+    dormant_cache_.erase(pop.region_id, pop.species_id);
+}
+
+uint32_t ProcessScheduler::despawn_batch(EntityId pop_id, uint32_t count) {
+    auto& pop = ctx_.get<component::Population>(pop_id);
+    // 只能销毁存活个体（已死亡的个体仍计入individual_count）
+    const GeneMoments* moments = ctx_.get_gene_stats().find(pop.region_id, pop.species_id);
+    count = std::min({count, pop.individual_count, moments ? moments->count() : 0u});
+
+    std::vector<EntityId> victims;
+    for (EntityId cid : ctx_.get_registry().view<component::SpeciesRef>()) {
+        if (victims.size() >= count) {
+            break;
+        }
+        if (ctx_.has<component::Position>(cid) &&
+            ctx_.get<component::Position>(cid).region_id == pop.region_id &&
+            ctx_.get<component::SpeciesRef>(cid).species_id == pop.species_id) {
+            victims.push_back(cid);
+        }
+    }
+
+    for (EntityId cid : victims) {
+        ctx_.destroy_entity(cid, core::sym::HqBudgetShrink);
+    }
+
+    uint32_t despawned = static_cast<uint32_t>(victims.size());
+    pop.individual_count -= despawned;
+    if (despawned > 0) {
+        std::cout << "[Scheduler] Despawned " << despawned << " creatures of species " << pop.species_id
+                  << " in region " << pop.region_id << " (HQ budget)" << std::endl;
+    }
+    return despawned;
+}
+
+uint32_t ProcessScheduler::restore_dormant(EntityId pop_id, uint32_t count) {
+    if (!dormant_cache_.is_enabled()) {
+        return 0;
+    }
+
+    auto& pop = ctx_.get<component::Population>(pop_id);
+    uint32_t remainder = pop.estimated_count > pop.individual_count
+        ? pop.estimated_count - pop.individual_count : 0;
+    count = std::min(count, remainder);
+
+    auto& registry = ctx_.get_registry();
+    uint32_t restored = 0;
+    DormantCreature creature;
+
+    while (restored < count &&
+           dormant_cache_.take(pop.region_id, pop.species_id, ctx_.get_time(), creature)) {
+        // 沿用原ID，个体在HQ→LQ→HQ之间保持连续
+        ctx_.restore_entity(creature.id, EntityType::Creature, core::sym::DormantRestore);
+        registry.add_component(creature.id, component::GameplayGene{creature.gene});
+        registry.add_component(creature.id, component::SpeciesRef{pop.species_id});
+        registry.add_component(creature.id, component::Position{pop.region_id, creature.local_pos});
+        registry.add_component(creature.id, component::Lifecycle{creature.lifecycle});
+
+        ctx_.record(effect::ComponentAdded{creature.id, core::sym::GameplayGene});
+        ctx_.record(effect::ComponentAdded{creature.id, core::sym::SpeciesRef});
+        ctx_.record(effect::ComponentAdded{creature.id, core::sym::Position});
+        ctx_.record(effect::ComponentAdded{creature.id, core::sym::Lifecycle});
+        ctx_.track_creature(creature.id);
+
+        spawned_scratch_.push_back(creature.id);
+        ++restored;
+    }
+
+    if (restored > 0) {
+        pop.individual_count += restored;
+        std::cout << "[Scheduler] Restored " << restored << " dormant creatures of species "
+                  << pop.species_id << " in region " << pop.region_id << std::endl;
+    }
+    return restored;
 }
 
 void ProcessScheduler::convert_hq_to_lq(uint32_t region_id, SpeciesId species_id) {
@@ -59,9 +259,27 @@ void ProcessScheduler::convert_hq_to_lq(uint32_t region_id, SpeciesId species_id
         }
     }
 
+    // 保存到休眠缓存（事件驱动模式下先推算到当前时刻的生命周期数值）
+    std::vector<DormantCreature> dormant;
+    if (dormant_cache_.is_enabled()) {
+        dormant.reserve(creatures_to_destroy.size());
+        for (EntityId cid : creatures_to_destroy) {
+            if (!ctx_.has<component::GameplayGene>(cid) || !ctx_.has<component::Lifecycle>(cid)) {
+                continue;
+            }
+            dormant.push_back({
+                cid,
+                ctx_.get<component::GameplayGene>(cid).gene,
+                get_creature_lifecycle(cid),
+                ctx_.get<component::Position>(cid).local_pos
+            });
+        }
+    }
+
     for (EntityId cid : creatures_to_destroy) {
-        ctx_.destroy_entity(cid, "hq_to_lq_conversion");
+        ctx_.destroy_entity(cid, core::sym::HqToLqConversion);
     }
+    dormant_cache_.store(region_id, species_id, ctx_.get_time(), std::move(dormant));
 
     // 3. 切换Population模式
     const auto& all_pops = ctx_.get_registry().view<component::Population>();
@@ -74,4 +292,54 @@ void ProcessScheduler::convert_hq_to_lq(uint32_t region_id, SpeciesId species_id
     }
 }
 
+void ProcessScheduler::begin_mq(uint32_t region_id) {
+    auto& registry = ctx_.get_registry();
+
+    std::vector<EntityId> pops;
+    for (EntityId pop_id : registry.view<component::Population>()) {
+        const auto& pop = registry.get_component<component::Population>(pop_id);
+        if (pop.region_id == region_id &&
+            pop.mode == component::Population::Mode::Simulated &&
+            !registry.has_component<component::PopulationSamples>(pop_id)) {
+            pops.push_back(pop_id);
+        }
+    }
+
+    // 立即生成首批样本（dt为0，只补足数量）
+    for (EntityId pop_id : pops) {
+        registry.add_component(pop_id, component::PopulationSamples{{}, 0.0f, 0});
+        update_samples_.execute(ctx_, pop_id, 0.0f, sample_options_);
+    }
+}
+
+void ProcessScheduler::end_mq(uint32_t region_id) {
+    auto& registry = ctx_.get_registry();
+
+    std::vector<EntityId> pops;
+    for (EntityId pop_id : registry.view<component::PopulationSamples>()) {
+        if (registry.get_component<component::Population>(pop_id).region_id == region_id) {
+            pops.push_back(pop_id);
+        }
+    }
+
+    for (EntityId pop_id : pops) {
+        registry.remove_component<component::PopulationSamples>(pop_id);
+    }
+}
+
+void ProcessScheduler::execute_representative_samples(float dt) {
+    for (EntityId pop_id : ctx_.get_registry().view<component::PopulationSamples>()) {
+        update_samples_.execute(ctx_, pop_id, dt, sample_options_);
+    }
+}
+
+size_t ProcessScheduler::get_representative_sample_count() const {
+    const auto& registry = ctx_.get_registry();
+    size_t total = 0;
+    for (EntityId pop_id : registry.view<component::PopulationSamples>()) {
+        total += registry.get_component<component::PopulationSamples>(pop_id).samples.size();
+    }
+    return total;
+}
+
 } // namespace process
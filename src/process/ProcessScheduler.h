@@ -1,6 +1,13 @@
 #pragma once
 
 #include "AtomicProcesses.h"
+#include "DormantCreatureCache.h"
+#include "FoodDynamics.h"
+#include "LifecycleEvents.h"
+#include "PopulationDiffusion.h"
+#include "ProcessRuntime.h"
+#include <unordered_map>
+#include <vector>
 
 // ============================================================
 // ProcessScheduler - Process调度和组合
@@ -9,6 +16,12 @@
 
 namespace process {
 
+// 个体生命周期的更新方式
+enum class LifecycleMode {
+    Sweep,        // 每步批量遍历所有个体（默认）
+    EventDriven   // 时间轮调度死亡/阈值事件，年龄和饥饿度惰性推算
+};
+
 class ProcessScheduler {
 public:
     ProcessScheduler(ProcessContext& ctx)
@@ -17,20 +30,102 @@ public:
           spawn_creatures_(),
           aggregate_creatures_(),
           process_lifecycle_(),
-          process_migration_() {}
+          process_migration_(),
+          fast_forward_(),
+          update_samples_() {}
 
     // 执行所有种群增长Process
     void execute_all_population_growth(float dt);
 
+    // 只更新指定Region的种群，每个Region使用各自累积的dt（多速率调度）
+    // dt不小于快进阈值的Region改用fast_forward_region
+    void execute_population_growth_in_regions(const std::vector<RegionTick>& ticks);
+
+    // 一次性推进Region内的LQ种群elapsed时间（O(1)追赶）
+    void fast_forward_region(uint32_t region_id, float elapsed);
+
+    // 种群积分方式
+    // Euler：逐种群执行UpdatePopulationGrowth（每步截断为整数，原行为）
+    // RK4/RK45：按Region批量积分连续状态，写回时四舍五入
+    void set_population_integrator(dynamics::IntegratorMode mode) { pop_integrator_.set_mode(mode); }
+    dynamics::IntegratorMode get_population_integrator() const { return pop_integrator_.get_mode(); }
+    void set_population_integrator_options(const dynamics::IntegratorOptions& options) {
+        pop_integrator_.set_options(options);
+    }
+
+    // 多速率更新中使用快进的dt阈值（<=0表示禁用，默认禁用）
+    // 快进求解的是连续模型（不做逐步整数截断），与逐步执行UpdatePopulationGrowth的结果
+    // 在小种群、捕食耦合时会明显分叉；启用后远处Region与逐步更新的Region遵循不同的生态轨迹
+    void set_fast_forward_threshold(float dt) { fast_forward_threshold_ = dt; }
+    float get_fast_forward_threshold() const { return fast_forward_threshold_; }
+
+    // Region食物恢复与消耗（所有Region一次SoA遍历，未启用时为空操作）
+    void execute_food_dynamics(float dt) { food_.execute(ctx_, dt); }
+
+    dynamics::FoodDynamics& get_food_dynamics() { return food_; }
+    const dynamics::FoodDynamics& get_food_dynamics() const { return food_; }
+
+    // LQ种群沿Region邻接图迁移（所有Region、所有物种一次完成，未启用时为空操作）
+    void execute_population_migration(float dt) { diffusion_.execute(ctx_, dt); }
+
+    dynamics::PopulationDiffusion& get_diffusion() { return diffusion_; }
+    const dynamics::PopulationDiffusion& get_diffusion() const { return diffusion_; }
+
     // 执行所有个体生命周期Process
     void execute_all_creature_lifecycle(float dt);
 
-    // LQ→HQ转换：生成个体
+    // 并行Process使用的工作线程数（>=1，含调度线程；Effect归并结果与线程数无关）
+    // 线程常驻，跨tick复用
+    void set_worker_count(uint32_t workers) { worker_pool_.resize(workers); }
+    uint32_t get_worker_count() const { return worker_pool_.size(); }
+
+    // 切换生命周期更新方式（切换时同步所有个体的数值）
+    void set_lifecycle_mode(LifecycleMode mode);
+    LifecycleMode get_lifecycle_mode() const { return lifecycle_mode_; }
+
+    // 查询个体当前的生命周期数值（事件驱动模式下按时间推算）
+    component::Lifecycle get_creature_lifecycle(EntityId creature_id) const;
+
+    const lifecycle::LifecycleEvents& get_lifecycle_events() const { return lifecycle_events_; }
+
+    // 长期运行的Process（协程）：恢复定时器到期或事件已触发的协程
+    void execute_long_running_processes(float dt);
+
+    // 启动一个长期运行的Process，协程通过ctx_产出Effect
+    co::TaskId spawn_process(co::SimTask task) { return runtime_.spawn(std::move(task)); }
+
+    co::ProcessRuntime& get_runtime() { return runtime_; }
+    const co::ProcessRuntime& get_runtime() const { return runtime_; }
+
+    // LQ→HQ转换：生成个体（一次完成）
     void convert_lq_to_hq(EntityId pop_id, uint32_t spawn_count);
 
-    // HQ→LQ转换：聚合统计并销毁个体
+    // 分帧的LQ→HQ转换：begin暂停种群级模拟，spawn_batch每次生成一批，finish切换到HQ
+    // 转换期间 estimated_count 不变，已生成的部分计入 individual_count
+    void begin_lq_to_hq(EntityId pop_id);
+    uint32_t spawn_batch(EntityId pop_id, uint32_t count);  // 返回实际生成的数量
+    void finish_lq_to_hq(EntityId pop_id);
+
+    // HQ预算缩减：销毁种群最多count个存活个体，退回LQ余量（individual_count相应减少）
+    uint32_t despawn_batch(EntityId pop_id, uint32_t count);
+
+    // HQ→LQ转换：聚合统计并销毁个体（启用休眠缓存时先保存个体，LQ→HQ时优先恢复）
     void convert_hq_to_lq(uint32_t region_id, SpeciesId species_id);
 
+    // MQ：Region内的LQ种群附加/移除代表个体样本（种群统计仍由种群级模拟维护）
+    void begin_mq(uint32_t region_id);
+    void end_mq(uint32_t region_id);
+
+    // 更新所有代表个体样本
+    void execute_representative_samples(float dt);
+    size_t get_representative_sample_count() const;
+
+    void set_sample_options(const UpdateRepresentativeSamples::Options& options) { sample_options_ = options; }
+    const UpdateRepresentativeSamples::Options& get_sample_options() const { return sample_options_; }
+
+    DormantCreatureCache& get_dormant_cache() { return dormant_cache_; }
+    const DormantCreatureCache& get_dormant_cache() const { return dormant_cache_; }
+
     // 访问ProcessContext（供ConversionSystem使用）
     ProcessContext& ctx_;
 
@@ -41,6 +136,37 @@ private:
     AggregateCreaturesToPopulation aggregate_creatures_;
     ProcessCreatureLifecycle process_lifecycle_;
     ProcessMigration process_migration_;
+    FastForwardPopulations fast_forward_;
+    UpdateRepresentativeSamples update_samples_;
+
+    UpdateRepresentativeSamples::Options sample_options_;
+
+    float fast_forward_threshold_ = 0.0f;
+
+    LifecycleMode lifecycle_mode_ = LifecycleMode::Sweep;
+    lifecycle::LifecycleEvents lifecycle_events_;
+    std::vector<EntityId> spawned_scratch_;
+
+    DormantCreatureCache dormant_cache_;
+
+    // 从休眠缓存恢复最多count个个体（不超过LQ余量），追加到spawned_scratch_
+    uint32_t restore_dormant(EntityId pop_id, uint32_t count);
+
+    co::ProcessRuntime runtime_;
+
+    WorkerPool worker_pool_;
+    ecs::EffectShardSet effect_shards_;  // 并行Process的分片Effect，tick屏障处归并
+
+    std::unordered_map<uint32_t, float> region_dt_scratch_;  // 复用的Region→dt查找表
+
+    // 批量积分（RK4/RK45模式）
+    void integrate_region_batches(float dt, const std::unordered_map<uint32_t, float>* region_dts);
+
+    dynamics::PopulationDiffusion diffusion_;
+    dynamics::FoodDynamics food_;
+
+    dynamics::PopulationIntegrator pop_integrator_{dynamics::IntegratorMode::Euler, dynamics::IntegratorOptions{}};
+    std::vector<dynamics::RegionBatch> batches_scratch_;
 };
 
 } // namespace process
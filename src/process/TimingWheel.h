@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// 分层时间轮（Hierarchical Timing Wheel）
+// 把连续时间按 resolution 离散成tick，4层 × 64槽，
+// 覆盖 64^4 个tick，更远的事件放在溢出表中。
+// 推进的代价只与经过的tick数和到期事件数有关，与挂起事件总数无关。
+//
+// 到期判定按tick粒度进行：tick <= 当前tick 的事件全部取出，
+// 精确时间由调用方复核（未真正到期的可重新schedule，会落到下一tick）
+// ============================================================
+
+namespace process {
+
+template<typename T>
+class TimingWheel {
+public:
+    struct Entry {
+        uint64_t tick;
+        double due_time;
+        T payload;
+    };
+
+    explicit TimingWheel(double resolution = 0.1)
+        : resolution_(resolution), current_tick_(0), size_(0) {
+        for (auto& level : levels_) {
+            level.resize(kSlots);
+        }
+    }
+
+    double get_resolution() const { return resolution_; }
+    uint64_t get_current_tick() const { return current_tick_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // 时间 → tick（向下取整，负时间视为0）
+    uint64_t to_tick(double time) const {
+        if (time <= 0.0) {
+            return 0;
+        }
+        return static_cast<uint64_t>(std::floor(time / resolution_));
+    }
+
+    // 挂起事件；已过期（tick <= 当前tick）的事件放到下一tick
+    void schedule(double due_time, const T& payload) {
+        uint64_t tick = to_tick(due_time);
+        if (tick <= current_tick_) {
+            tick = current_tick_ + 1;
+        }
+        insert(Entry{tick, due_time, payload});
+        ++size_;
+    }
+
+    // 推进到 now 所在的tick，把所有到期事件追加到 fired（按tick先后）
+    void advance(double now, std::vector<Entry>& fired) {
+        uint64_t target = to_tick(now);
+
+        while (current_tick_ < target && size_ > 0) {
+            uint64_t t = ++current_tick_;
+
+            // 高层先下放：每跨过一个上层槽的边界，把该槽的事件重新分配到下层
+            if ((t & kTopMask) == 0) {
+                cascade_overflow();
+            }
+            for (int level = kLevels - 1; level >= 1; --level) {
+                uint64_t span_mask = (uint64_t{1} << (kSlotBits * level)) - 1;
+                if ((t & span_mask) == 0) {
+                    cascade(level, slot_index(t, level));
+                }
+            }
+
+            auto& slot = levels_[0][t & (kSlots - 1)];
+            if (!slot.empty()) {
+                size_ -= slot.size();
+                fired.insert(fired.end(), slot.begin(), slot.end());
+                slot.clear();
+            }
+        }
+
+        // 没有挂起事件时直接跳到目标tick
+        if (current_tick_ < target) {
+            current_tick_ = target;
+        }
+    }
+
+    void clear() {
+        for (auto& level : levels_) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        overflow_.clear();
+        size_ = 0;
+    }
+
+    // 清空并把时间轴重置到 now
+    void reset(double now = 0.0) {
+        clear();
+        current_tick_ = to_tick(now);
+    }
+
+private:
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr size_t kSlots = size_t{1} << kSlotBits;
+    static constexpr uint64_t kTopMask = (uint64_t{1} << (kSlotBits * kLevels)) - 1;
+
+    static size_t slot_index(uint64_t tick, int level) {
+        return static_cast<size_t>((tick >> (kSlotBits * level)) & (kSlots - 1));
+    }
+
+    // 按与当前tick最高的不同位段选择层级，保证槽位在本轮之后才被访问
+    void insert(const Entry& entry) {
+        uint64_t diff = entry.tick ^ current_tick_;
+        for (int level = 0; level < kLevels; ++level) {
+            if (diff < (uint64_t{1} << (kSlotBits * (level + 1)))) {
+                levels_[level][slot_index(entry.tick, level)].push_back(entry);
+                return;
+            }
+        }
+        overflow_.push_back(entry);
+    }
+
+    void cascade(int level, size_t slot) {
+        std::vector<Entry> moving;
+        moving.swap(levels_[level][slot]);
+        for (const auto& entry : moving) {
+            insert(entry);
+        }
+    }
+
+    void cascade_overflow() {
+        std::vector<Entry> moving;
+        moving.swap(overflow_);
+        for (const auto& entry : moving) {
+            insert(entry);
+        }
+    }
+
+    double resolution_;
+    uint64_t current_tick_;
+    size_t size_;
+
+    std::vector<std::vector<Entry>> levels_[kLevels];
+    std::vector<Entry> overflow_;
+};
+
+} // namespace process
@@ -0,0 +1,100 @@
+#include "WorkerPool.h"
+
+namespace process {
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+void WorkerPool::resize(uint32_t workers) {
+    workers = workers > 0 ? workers : 1;
+    if (workers == size()) {
+        return;
+    }
+
+    stop();
+
+    // 新线程从当前轮次开始等待，不会把已结束的一轮当作新任务执行
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = false;
+        generation = generation_;
+    }
+    threads_.reserve(workers - 1);
+    for (uint32_t i = 1; i < workers; ++i) {
+        threads_.emplace_back(&WorkerPool::worker_loop, this, generation);
+    }
+}
+
+void WorkerPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void WorkerPool::parallel_for(size_t count, const std::function<void(size_t)>& task) {
+    if (count == 0) {
+        return;
+    }
+    if (threads_.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = count;
+        next_task_.store(0, std::memory_order_relaxed);
+        active_ = static_cast<uint32_t>(threads_.size());
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    run_tasks();
+
+    // 等待后台线程离开本轮（之后task_才可失效）
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return active_ == 0; });
+    task_ = nullptr;
+}
+
+void WorkerPool::run_tasks() {
+    for (size_t i = next_task_.fetch_add(1, std::memory_order_relaxed); i < task_count_;
+         i = next_task_.fetch_add(1, std::memory_order_relaxed)) {
+        (*task_)(i);
+    }
+}
+
+void WorkerPool::worker_loop(uint64_t seen) {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]() { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+        }
+
+        run_tasks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+}
+
+} // namespace process
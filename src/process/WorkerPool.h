@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// 常驻工作线程池（并行Process用）
+// 线程在resize时创建，之后跨tick复用，每次parallel_for只需唤醒；
+// 调用线程也参与执行，workers = N 表示共N个线程处理任务。
+// 任务下标由原子计数器动态领取，哪个线程执行哪个下标不确定，
+// 任务本身须只写各自下标的输出（如EffectShard），结果才与线程数无关。
+// ============================================================
+
+namespace process {
+
+class WorkerPool {
+public:
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // 设置总线程数（含调用线程，>=1）；线程数变化时重建后台线程
+    void resize(uint32_t workers);
+    uint32_t size() const { return static_cast<uint32_t>(threads_.size()) + 1; }
+
+    // 对 [0, count) 的每个下标执行task，返回时全部完成
+    void parallel_for(size_t count, const std::function<void(size_t)>& task);
+
+private:
+    // seen: 线程创建时的轮次（只响应之后的parallel_for）
+    void worker_loop(uint64_t seen);
+    void run_tasks();
+    void stop();
+
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_ = 0;   // 每次parallel_for递增，唤醒后台线程
+    uint32_t active_ = 0;       // 本轮尚未完成的后台线程数
+    bool stopping_ = false;
+
+    // 当前一轮的任务（只在generation_切换时由调用线程写入）
+    const std::function<void(size_t)>* task_ = nullptr;
+    size_t task_count_ = 0;
+    std::atomic<size_t> next_task_{0};
+};
+
+} // namespace process
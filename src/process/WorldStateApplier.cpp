@@ -0,0 +1,147 @@
+#include "WorldStateApplier.h"
+#include "PopulationDynamics.h"
+#include "components/Components.h"
+#include <cmath>
+
+namespace ecs {
+
+WorldStateApplier::WorldStateApplier(Registry& registry, SimulationState& state)
+    : registry_(registry), state_(state) {
+}
+
+void WorldStateApplier::apply(const effect::Effect& e) {
+    bool ok = std::visit([this](const auto& eff) { return apply_one(eff); }, e);
+    if (ok) {
+        ++applied_;
+    } else {
+        ++skipped_;
+    }
+}
+
+void WorldStateApplier::apply_frame(const JournalFrame& frame) {
+    for (const auto& e : frame.effects) {
+        apply(e);
+    }
+    state_.current_time = frame.time;
+    state_.lifecycle_clock = frame.lifecycle_clock;
+}
+
+bool WorldStateApplier::apply_one(const effect::EntityCreated& e) {
+    registry_.create_entity_with_id(e.entity_id, e.type);
+    return true;
+}
+
+bool WorldStateApplier::apply_one(const effect::EntityDestroyed& e) {
+    if (!registry_.entity_exists(e.entity_id)) {
+        return false;
+    }
+    registry_.destroy_entity(e.entity_id);
+    return true;
+}
+
+bool WorldStateApplier::apply_one(const effect::ResourceChanged& e) {
+    if (e.resource_name == core::sym::EstimatedCount) {
+        if (!registry_.has_component<component::Population>(e.entity_id)) {
+            return false;
+        }
+        auto& pop = registry_.get_component<component::Population>(e.entity_id);
+        process::dynamics::store_count(pop, static_cast<uint32_t>(std::lround(e.new_value)));
+        return true;
+    }
+
+    if (!registry_.has_component<component::Lifecycle>(e.entity_id)) {
+        return false;
+    }
+    auto& life = registry_.get_component<component::Lifecycle>(e.entity_id);
+
+    // 事件驱动模式下组件保存anchor_time时刻的数值，Effect中是推算到当时的数值，不能写回
+    if (registry_.has_component<component::LifecycleSchedule>(e.entity_id)) {
+        return e.resource_name == core::sym::Age || e.resource_name == core::sym::Hunger ||
+               e.resource_name == core::sym::Health;
+    }
+
+    if (e.resource_name == core::sym::Age) {
+        life.age = e.new_value;
+    } else if (e.resource_name == core::sym::Hunger) {
+        life.hunger = e.new_value;
+    } else if (e.resource_name == core::sym::Health) {
+        life.health = e.new_value;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool WorldStateApplier::apply_one(const effect::Migration& e) {
+    if (!registry_.has_component<component::Position>(e.entity_id)) {
+        return false;
+    }
+    registry_.get_component<component::Position>(e.entity_id).region_id = e.to_region;
+    return true;
+}
+
+bool WorldStateApplier::apply_one(const effect::Death& e) {
+    (void)e;
+    return true;
+}
+
+bool WorldStateApplier::apply_one(const effect::Reproduction& e) {
+    (void)e;
+    return true;
+}
+
+bool WorldStateApplier::apply_one(const effect::ComponentAdded& e) {
+    if (!registry_.entity_exists(e.entity_id)) {
+        return false;
+    }
+
+    // 已有组件（例如快照中已存在）时保留原值
+    if (e.component_type == core::sym::GameplayGene) {
+        if (!registry_.has_component<component::GameplayGene>(e.entity_id)) {
+            registry_.add_component(e.entity_id, component::GameplayGene{});
+        }
+    } else if (e.component_type == core::sym::SpeciesRef) {
+        if (!registry_.has_component<component::SpeciesRef>(e.entity_id)) {
+            registry_.add_component(e.entity_id, component::SpeciesRef{});
+        }
+    } else if (e.component_type == core::sym::Position) {
+        if (!registry_.has_component<component::Position>(e.entity_id)) {
+            registry_.add_component(e.entity_id, component::Position{});
+        }
+    } else if (e.component_type == core::sym::Lifecycle) {
+        if (!registry_.has_component<component::Lifecycle>(e.entity_id)) {
+            registry_.add_component(e.entity_id, component::Lifecycle{});
+        }
+    } else if (e.component_type == core::sym::Population) {
+        if (!registry_.has_component<component::Population>(e.entity_id)) {
+            registry_.add_component(e.entity_id, component::Population{});
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool WorldStateApplier::apply_one(const effect::RegionChanged& e) {
+    // 世界范围的变化（生命周期模式）由同一tick的关键帧恢复
+    if (e.region_id == 0) {
+        return e.field == core::sym::LifecycleMode;
+    }
+
+    auto region_result = state_.get_region(e.region_id);
+    if (region_result.is_err()) {
+        return false;
+    }
+    Region& region = region_result.value().get();
+
+    if (e.field == core::sym::RegionMode) {
+        region.mode = static_cast<Region::Mode>(std::lround(e.new_value));
+    } else if (e.field == core::sym::CurrentFood) {
+        region.current_food = e.new_value;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace ecs
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Effect.h"
+#include "EffectJournal.h"
+#include "ecs/Registry.h"
+#include "simulation/SimulationState.h"
+#include <cstdint>
+
+// ============================================================
+// WorldStateApplier - 把Effect直接应用到世界状态（回放/定位用）
+// 不运行任何Process：从快照恢复后按日志顺序应用Effect即可前进到目标tick。
+//
+// Effect只描述结构变化和Resource数值：
+//   EntityCreated/EntityDestroyed → 创建/销毁实体（保持原ID）
+//   ComponentAdded                → 添加默认值组件（数值由后续Effect或下一个快照补全）
+//   ResourceChanged               → Age/Hunger/Health写入Lifecycle，EstimatedCount写入Population
+//                                   （带LifecycleSchedule的个体组件保存锚点数值，不写入推算值）
+//   Migration                     → Position.region_id
+//   Death/Reproduction            → 仅记录，不改变状态（销毁/创建有各自的Effect）
+//   RegionChanged                 → Region::mode / current_food（生命周期模式切换由关键帧恢复）
+// 每帧的生命周期时钟写入 SimulationState::lifecycle_clock。
+// 目标实体不存在的Effect计入 skipped，不视为错误。
+// ============================================================
+
+namespace ecs {
+
+class WorldStateApplier {
+public:
+    WorldStateApplier(Registry& registry, SimulationState& state);
+
+    void apply(const effect::Effect& e);
+
+    // 应用一帧日志并把模拟时间设为该帧的时间
+    void apply_frame(const JournalFrame& frame);
+
+    uint64_t get_applied() const { return applied_; }
+    uint64_t get_skipped() const { return skipped_; }
+
+private:
+    bool apply_one(const effect::EntityCreated& e);
+    bool apply_one(const effect::EntityDestroyed& e);
+    bool apply_one(const effect::ResourceChanged& e);
+    bool apply_one(const effect::Migration& e);
+    bool apply_one(const effect::Death& e);
+    bool apply_one(const effect::Reproduction& e);
+    bool apply_one(const effect::ComponentAdded& e);
+    bool apply_one(const effect::RegionChanged& e);
+
+    Registry& registry_;
+    SimulationState& state_;
+    uint64_t applied_ = 0;
+    uint64_t skipped_ = 0;
+};
+
+} // namespace ecs
@@ -20,8 +20,10 @@ struct Region {
 
     // HQ/LQ模式管理
     enum class Mode {
-        LQ,  // 低精度：种群统计模拟
-        HQ   // 高精度：个体模拟
+        LQ,      // 低精度：种群统计模拟
+        HQ,      // 高精度：个体模拟
+        Warming, // 预热：预计相机即将到达，后台低优先级生成个体（不渲染）
+        MQ       // 中精度：种群统计模拟 + 少量代表个体样本（实例化渲染）
     };
     Mode mode;
     Mode target_mode;  // 目标模式（ConversionSystem会将mode转换到target_mode）
@@ -38,3 +40,19 @@ struct Region {
         : id(id), name(name), food_capacity(food_cap), current_food(food_cap),
           temperature(temp), mode(Mode::LQ), target_mode(Mode::LQ) {}
 };
+
+inline const char* region_mode_name(Region::Mode mode) {
+    switch (mode) {
+        case Region::Mode::LQ: return "LQ";
+        case Region::Mode::HQ: return "HQ";
+        case Region::Mode::Warming: return "Warming";
+        case Region::Mode::MQ: return "MQ";
+    }
+    return "Unknown";
+}
+
+// 多速率调度中某个Region本步的更新请求（dt为该Region累积的时间）
+struct RegionTick {
+    uint32_t region_id;
+    float dt;
+};
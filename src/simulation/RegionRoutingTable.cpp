@@ -0,0 +1,203 @@
+#include "RegionRoutingTable.h"
+#include <algorithm>
+#include <utility>
+
+void RegionRoutingTable::build(const std::map<uint32_t, Region>& regions) {
+    region_ids_.clear();
+    index_.clear();
+    for (const auto& [id, region] : regions) {
+        if (region_ids_.size() >= kUnreachable) {
+            break;  // 紧凑下标为16位
+        }
+        index_[id] = static_cast<uint16_t>(region_ids_.size());
+        region_ids_.push_back(id);
+    }
+
+    adjacency_.assign(region_ids_.size(), {});
+    for (const auto& [id, region] : regions) {
+        auto from = index_.find(id);
+        if (from == index_.end()) {
+            continue;
+        }
+        for (uint32_t neighbor : region.neighbors) {
+            auto to = index_.find(neighbor);
+            if (to != index_.end()) {
+                link(from->second, to->second);
+            }
+        }
+    }
+
+    const size_t n = region_ids_.size();
+    hops_.assign(n * n, kUnreachable);
+    next_.assign(n * n, kUnreachable);
+    for (size_t s = 0; s < n; ++s) {
+        bfs(static_cast<uint16_t>(s));
+    }
+}
+
+void RegionRoutingTable::link(uint16_t a, uint16_t b) {
+    if (a == b) {
+        return;
+    }
+    // 邻接表保持有序：BFS按下标顺序扩展，相同跳数时下一跳的选择是确定的
+    for (auto [u, v] : {std::pair{a, b}, std::pair{b, a}}) {
+        auto& list = adjacency_[u];
+        auto it = std::lower_bound(list.begin(), list.end(), v);
+        if (it == list.end() || *it != v) {
+            list.insert(it, v);
+        }
+    }
+}
+
+void RegionRoutingTable::unlink(uint16_t a, uint16_t b) {
+    for (auto [u, v] : {std::pair{a, b}, std::pair{b, a}}) {
+        auto& list = adjacency_[u];
+        auto it = std::lower_bound(list.begin(), list.end(), v);
+        if (it != list.end() && *it == v) {
+            list.erase(it);
+        }
+    }
+}
+
+void RegionRoutingTable::bfs(uint16_t src) {
+    uint16_t* hops_row = hops_.data() + cell(src, 0);
+    uint16_t* next_row = next_.data() + cell(src, 0);
+    std::fill(hops_row, hops_row + region_ids_.size(), kUnreachable);
+    std::fill(next_row, next_row + region_ids_.size(), kUnreachable);
+
+    hops_row[src] = 0;
+    next_row[src] = src;
+
+    queue_scratch_.clear();
+    queue_scratch_.push_back(src);
+    for (size_t head = 0; head < queue_scratch_.size(); ++head) {
+        uint16_t u = queue_scratch_[head];
+        for (uint16_t v : adjacency_[u]) {
+            if (hops_row[v] != kUnreachable) {
+                continue;
+            }
+            hops_row[v] = static_cast<uint16_t>(hops_row[u] + 1);
+            next_row[v] = u == src ? v : next_row[u];
+            queue_scratch_.push_back(v);
+        }
+    }
+}
+
+void RegionRoutingTable::add_edge(uint32_t a, uint32_t b) {
+    auto ia = index_.find(a);
+    auto ib = index_.find(b);
+    if (ia == index_.end() || ib == index_.end() || a == b) {
+        return;
+    }
+    const uint16_t ua = ia->second, ub = ib->second;
+    link(ua, ub);
+
+    // 新的最短路径最多经过新边一次：d'(s,t) = min(d(s,t), d(s,a)+1+d(b,t), d(s,b)+1+d(a,t))
+    // 图是无向的，d(s,a) = d(a,s)；先保存旧的a、b两行和指向a、b的下一跳，避免读到本轮已更新的值
+    const size_t n = region_ids_.size();
+    std::vector<uint16_t> hops_a(hops_.begin() + cell(ua, 0), hops_.begin() + cell(ua, 0) + n);
+    std::vector<uint16_t> hops_b(hops_.begin() + cell(ub, 0), hops_.begin() + cell(ub, 0) + n);
+    std::vector<uint16_t> next_to_a(n), next_to_b(n);
+    for (size_t s = 0; s < n; ++s) {
+        next_to_a[s] = next_[cell(static_cast<uint16_t>(s), ua)];
+        next_to_b[s] = next_[cell(static_cast<uint16_t>(s), ub)];
+    }
+
+    auto relax = [&](uint16_t near, uint16_t far, const std::vector<uint16_t>& hops_near,
+                     const std::vector<uint16_t>& hops_far, const std::vector<uint16_t>& next_to_near) {
+        for (size_t s = 0; s < n; ++s) {
+            uint32_t to_near = hops_near[s];
+            if (to_near == kUnreachable) {
+                continue;
+            }
+            uint16_t first = s == near ? far : next_to_near[s];
+
+            uint16_t* hops_row = hops_.data() + cell(static_cast<uint16_t>(s), 0);
+            uint16_t* next_row = next_.data() + cell(static_cast<uint16_t>(s), 0);
+            for (size_t t = 0; t < n; ++t) {
+                if (hops_far[t] == kUnreachable) {
+                    continue;
+                }
+                uint32_t via = to_near + 1 + hops_far[t];
+                if (via < hops_row[t]) {
+                    hops_row[t] = static_cast<uint16_t>(via);
+                    next_row[t] = first;
+                }
+            }
+        }
+    };
+    relax(ua, ub, hops_a, hops_b, next_to_a);
+    relax(ub, ua, hops_b, hops_a, next_to_b);
+}
+
+void RegionRoutingTable::remove_edge(uint32_t a, uint32_t b) {
+    auto ia = index_.find(a);
+    auto ib = index_.find(b);
+    if (ia == index_.end() || ib == index_.end()) {
+        return;
+    }
+    const uint16_t ua = ia->second, ub = ib->second;
+    unlink(ua, ub);
+
+    // 只有最短路径DAG中包含该边的源（到a、b的跳数相差1）才需要重算
+    const size_t n = region_ids_.size();
+    for (size_t s = 0; s < n; ++s) {
+        uint16_t da = hops_[cell(static_cast<uint16_t>(s), ua)];
+        uint16_t db = hops_[cell(static_cast<uint16_t>(s), ub)];
+        if (da != kUnreachable && db != kUnreachable && (da + 1 == db || db + 1 == da)) {
+            bfs(static_cast<uint16_t>(s));
+        }
+    }
+}
+
+uint16_t RegionRoutingTable::hops(uint32_t from, uint32_t to) const {
+    auto i = index_.find(from);
+    auto j = index_.find(to);
+    if (i == index_.end() || j == index_.end()) {
+        return kUnreachable;
+    }
+    return hops_[cell(i->second, j->second)];
+}
+
+uint32_t RegionRoutingTable::next_hop(uint32_t from, uint32_t to) const {
+    auto i = index_.find(from);
+    auto j = index_.find(to);
+    if (i == index_.end() || j == index_.end() || i->second == j->second) {
+        return 0;
+    }
+    uint16_t next = next_[cell(i->second, j->second)];
+    return next != kUnreachable ? region_ids_[next] : 0;
+}
+
+std::vector<uint32_t> RegionRoutingTable::path(uint32_t from, uint32_t to) const {
+    std::vector<uint32_t> result;
+    auto i = index_.find(from);
+    auto j = index_.find(to);
+    if (i == index_.end() || j == index_.end() || hops_[cell(i->second, j->second)] == kUnreachable) {
+        return result;
+    }
+
+    uint16_t current = i->second;
+    const uint16_t target = j->second;
+    result.push_back(region_ids_[current]);
+    while (current != target) {
+        current = next_[cell(current, target)];
+        result.push_back(region_ids_[current]);
+    }
+    return result;
+}
+
+void RegionRoutingTable::regions_within(uint32_t from, uint16_t max_hops, std::vector<uint32_t>& out) const {
+    out.clear();
+    auto i = index_.find(from);
+    if (i == index_.end()) {
+        return;
+    }
+
+    const uint16_t* hops_row = hops_.data() + cell(i->second, 0);
+    for (size_t t = 0; t < region_ids_.size(); ++t) {
+        if (t != i->second && hops_row[t] != kUnreachable && hops_row[t] <= max_hops) {
+            out.push_back(region_ids_[t]);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Region.h"
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================
+// Region路由表（全源最短路径）
+// 在Region邻接图上对每个源Region做一次BFS，预计算任意两Region之间的
+// 跳数和最短路径的下一跳，长程迁移查询距离/路径时为O(1)查表，不再逐次搜索图。
+// 存储为按源Region行优先的稠密 uint16_t 矩阵（每对Region 4字节），
+// 同一源的整行连续存放，遍历某个源的所有目标时缓存友好。
+// 邻接关系变化时增量更新：加边为O(N²)的松弛，删边只重算受影响的源。
+// ============================================================
+
+class RegionRoutingTable {
+public:
+    static constexpr uint16_t kUnreachable = 0xFFFF;
+
+    // 按Region的邻接关系完整重建
+    void build(const std::map<uint32_t, Region>& regions);
+
+    // 增量更新（两个Region都必须已在表中，否则调用方应重建）
+    void add_edge(uint32_t a, uint32_t b);
+    void remove_edge(uint32_t a, uint32_t b);
+
+    bool contains(uint32_t region_id) const { return index_.count(region_id) != 0; }
+    size_t size() const { return region_ids_.size(); }
+
+    // 跳数（不可达或Region不存在时返回kUnreachable）
+    uint16_t hops(uint32_t from, uint32_t to) const;
+
+    // 最短路径上from之后的第一个Region（from == to、不可达或Region不存在时返回0）
+    uint32_t next_hop(uint32_t from, uint32_t to) const;
+
+    // 完整路径（含起点和终点），不可达时为空
+    std::vector<uint32_t> path(uint32_t from, uint32_t to) const;
+
+    // from在max_hops跳以内的所有Region（不含from本身），按Region ID排序
+    void regions_within(uint32_t from, uint16_t max_hops, std::vector<uint32_t>& out) const;
+
+private:
+    size_t cell(uint16_t from, uint16_t to) const { return static_cast<size_t>(from) * region_ids_.size() + to; }
+
+    // 以src为源做一次BFS，重写该行的跳数和下一跳
+    void bfs(uint16_t src);
+
+    void link(uint16_t a, uint16_t b);
+    void unlink(uint16_t a, uint16_t b);
+
+    // 紧凑下标 ↔ Region ID
+    std::vector<uint32_t> region_ids_;
+    std::unordered_map<uint32_t, uint16_t> index_;
+
+    // 邻接表（紧凑下标，无向图，两端各存一次）
+    std::vector<std::vector<uint16_t>> adjacency_;
+
+    // 行优先 N×N：hops_[cell(s, t)] 为跳数，next_[cell(s, t)] 为下一跳的紧凑下标
+    std::vector<uint16_t> hops_;
+    std::vector<uint16_t> next_;
+
+    std::vector<uint16_t> queue_scratch_;
+};
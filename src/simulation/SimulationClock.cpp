@@ -0,0 +1,58 @@
+#include "SimulationClock.h"
+#include <algorithm>
+#include <cmath>
+
+SimulationClock::SimulationClock(float fixed_dt, uint32_t max_substeps)
+    : fixed_dt_(fixed_dt > 0.0f ? fixed_dt : 0.1f),
+      max_substeps_(std::max(1u, max_substeps)),
+      accumulator_(0.0f),
+      steps_last_frame_(0),
+      total_steps_(0),
+      dropped_time_(0.0f) {
+}
+
+uint32_t SimulationClock::advance(float frame_delta) {
+    // 负值或NaN视为0
+    if (!(frame_delta > 0.0f)) {
+        steps_last_frame_ = 0;
+        return 0;
+    }
+
+    accumulator_ += frame_delta;
+
+    uint32_t steps = 0;
+    while (accumulator_ >= fixed_dt_ && steps < max_substeps_) {
+        accumulator_ -= fixed_dt_;
+        ++steps;
+    }
+
+    // 达到子步上限仍有积压：丢弃整步部分，只保留不足一步的余量
+    if (accumulator_ >= fixed_dt_) {
+        float backlog = accumulator_;
+        accumulator_ = std::fmod(accumulator_, fixed_dt_);
+        dropped_time_ += backlog - accumulator_;
+    }
+
+    steps_last_frame_ = steps;
+    total_steps_ += steps;
+    return steps;
+}
+
+float SimulationClock::interpolation_alpha() const {
+    return std::clamp(accumulator_ / fixed_dt_, 0.0f, 1.0f);
+}
+
+void SimulationClock::set_fixed_dt(float dt) {
+    if (dt > 0.0f) {
+        fixed_dt_ = dt;
+    }
+}
+
+void SimulationClock::set_max_substeps(uint32_t n) {
+    max_substeps_ = std::max(1u, n);
+}
+
+void SimulationClock::reset() {
+    accumulator_ = 0.0f;
+    steps_last_frame_ = 0;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+// ============================================================
+// SimulationClock - 固定步长模拟时钟
+// 累积渲染帧的真实时间，按固定步长推进模拟；
+// 每帧子步数有上限，超出部分直接丢弃，避免慢帧引起的"死亡螺旋"
+// ============================================================
+
+class SimulationClock {
+public:
+    SimulationClock(float fixed_dt = 0.1f, uint32_t max_substeps = 4);
+
+    // 累加一帧的时间，返回本帧应执行的固定步数（不超过max_substeps）
+    uint32_t advance(float frame_delta);
+
+    // 插值系数 [0, 1)：累加器中剩余时间占一个固定步长的比例
+    // 渲染层用它在上一步和当前步的状态之间插值
+    float interpolation_alpha() const;
+
+    // 固定步长（模拟时间单位）
+    float get_fixed_dt() const { return fixed_dt_; }
+    void set_fixed_dt(float dt);
+
+    // 每帧最多执行的子步数
+    uint32_t get_max_substeps() const { return max_substeps_; }
+    void set_max_substeps(uint32_t n);
+
+    // 统计信息
+    uint32_t get_steps_last_frame() const { return steps_last_frame_; }
+    uint64_t get_total_steps() const { return total_steps_; }
+    float get_dropped_time() const { return dropped_time_; }  // 因子步上限被丢弃的累计时间
+
+    // 清空累加器（例如暂停恢复后）
+    void reset();
+
+private:
+    float fixed_dt_;
+    uint32_t max_substeps_;
+    float accumulator_;
+    uint32_t steps_last_frame_;
+    uint64_t total_steps_;
+    float dropped_time_;
+};
@@ -1,9 +1,12 @@
 #include "SimulationState.h"
 #include <stdexcept>
+#include <algorithm>
 #include <cmath>
 
 SimulationState::SimulationState()
-    : current_time(0.0f) {
+    : current_time(0.0f)
+    , lifecycle_clock(0.0)
+    , world_seed(0x5EEDC0DE2024ull) {
 }
 
 void SimulationState::initialize() {
@@ -27,6 +30,8 @@ void SimulationState::initialize() {
     regions_[4].neighbors = {1, 5};
     regions_[5].neighbors = {2, 4, 6};
     regions_[6].neighbors = {3, 5};
+    routing_.build(regions_);
+    ++topology_version_;
 
     // 初始化物种模板
     species_templates_.push_back(species_templates::rabbit());
@@ -60,6 +65,62 @@ SimulationState::get_region(uint32_t id) const {
     );
 }
 
+core::Result<void, core::ErrorCode> SimulationState::connect_regions(uint32_t a, uint32_t b) {
+    using R = core::Result<void, core::ErrorCode>;
+    auto ia = regions_.find(a);
+    auto ib = regions_.find(b);
+    if (ia == regions_.end() || ib == regions_.end()) {
+        return R::Err(core::ErrorCode::REGION_NOT_FOUND);
+    }
+    if (a == b) {
+        return R::Err(core::ErrorCode::INVALID_REGION_ID);
+    }
+
+    auto& na = ia->second.neighbors;
+    auto& nb = ib->second.neighbors;
+    if (std::find(na.begin(), na.end(), b) != na.end()) {
+        return R::Err(core::ErrorCode::ALREADY_EXISTS);
+    }
+    na.push_back(b);
+    if (std::find(nb.begin(), nb.end(), a) == nb.end()) {
+        nb.push_back(a);
+    }
+
+    if (routing_.contains(a) && routing_.contains(b)) {
+        routing_.add_edge(a, b);
+    } else {
+        routing_.build(regions_);
+    }
+    ++topology_version_;
+    return R::Ok();
+}
+
+core::Result<void, core::ErrorCode> SimulationState::disconnect_regions(uint32_t a, uint32_t b) {
+    using R = core::Result<void, core::ErrorCode>;
+    auto ia = regions_.find(a);
+    auto ib = regions_.find(b);
+    if (ia == regions_.end() || ib == regions_.end()) {
+        return R::Err(core::ErrorCode::REGION_NOT_FOUND);
+    }
+
+    auto& na = ia->second.neighbors;
+    auto& nb = ib->second.neighbors;
+    auto it = std::find(na.begin(), na.end(), b);
+    if (it == na.end()) {
+        return R::Err(core::ErrorCode::NOT_FOUND);
+    }
+    na.erase(it);
+    nb.erase(std::remove(nb.begin(), nb.end(), a), nb.end());
+
+    if (routing_.contains(a) && routing_.contains(b)) {
+        routing_.remove_edge(a, b);
+    } else {
+        routing_.build(regions_);
+    }
+    ++topology_version_;
+    return R::Ok();
+}
+
 core::Result<core::RefWrapper<const SpeciesTemplate>, core::ErrorCode>
 SimulationState::get_species_template(SpeciesId id) const {
     for (const auto& st : species_templates_) {
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Region.h"
+#include "RegionRoutingTable.h"
 #include "SpeciesTemplate.h"
 #include "core/Result.h"
 #include "core/Error.h"
+#include <cstdint>
 #include <map>
 #include <vector>
 
@@ -22,11 +24,30 @@ public:
     // 时间管理
     float current_time;
 
+    // 事件驱动生命周期的时钟（天），LifecycleSchedule::anchor_time 以它为基准；
+    // 只在事件驱动模式下推进，由LifecycleEvents发布，写入日志帧和快照供回放推算
+    double lifecycle_clock;
+
+    // 世界随机种子：所有确定性随机流（core::CounterRng）的密钥
+    uint64_t world_seed;
+
     // Region访问 (返回 Result 以处理错误)
     core::Result<core::RefWrapper<Region>, core::ErrorCode> get_region(uint32_t id);
     core::Result<core::RefWrapper<const Region>, core::ErrorCode> get_region(uint32_t id) const;
     const std::map<uint32_t, Region>& get_all_regions() const { return regions_; }
 
+    // 邻接关系修改（双向），同时增量更新路由表
+    // Region不存在返回REGION_NOT_FOUND，自环返回INVALID_REGION_ID，
+    // 已相邻返回ALREADY_EXISTS，本不相邻返回NOT_FOUND
+    core::Result<void, core::ErrorCode> connect_regions(uint32_t a, uint32_t b);
+    core::Result<void, core::ErrorCode> disconnect_regions(uint32_t a, uint32_t b);
+
+    // 全源最短路径路由表（长程迁移O(1)查询跳数/下一跳）
+    const RegionRoutingTable& get_routing() const { return routing_; }
+
+    // 邻接关系每次变化时递增（缓存邻接图的模块据此重建）
+    uint32_t get_topology_version() const { return topology_version_; }
+
     // 物种模板访问 (返回 Result 以处理错误)
     core::Result<core::RefWrapper<const SpeciesTemplate>, core::ErrorCode>
         get_species_template(SpeciesId id) const;
@@ -34,5 +55,7 @@ public:
 
 private:
     std::map<uint32_t, Region> regions_;
+    RegionRoutingTable routing_;
+    uint32_t topology_version_ = 0;
     std::vector<SpeciesTemplate> species_templates_;
 };
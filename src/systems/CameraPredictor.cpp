@@ -0,0 +1,93 @@
+#include "CameraPredictor.h"
+#include <algorithm>
+#include <cmath>
+
+void CameraPredictor::add_sample(double time, float x, float z) {
+    // 时间回退（例如重新开始场景）时丢弃旧历史
+    if (!history_.empty() && time < history_.back().time) {
+        clear();
+    }
+
+    history_.push_back({time, x, z});
+    while (history_.size() > kMinSamples &&
+           time - history_.front().time > config_.history_seconds) {
+        history_.pop_front();
+    }
+}
+
+bool CameraPredictor::get_velocity(float& vx, float& vz) const {
+    if (history_.size() < kMinSamples) {
+        return false;
+    }
+
+    // 最小二乘拟合 x(t)、z(t) 的斜率（以首个样本为时间原点，避免大数相减）
+    const double t0 = history_.front().time;
+    double mean_t = 0.0, mean_x = 0.0, mean_z = 0.0;
+    for (const auto& s : history_) {
+        mean_t += s.time - t0;
+        mean_x += s.x;
+        mean_z += s.z;
+    }
+    const double n = static_cast<double>(history_.size());
+    mean_t /= n;
+    mean_x /= n;
+    mean_z /= n;
+
+    double stt = 0.0, stx = 0.0, stz = 0.0;
+    for (const auto& s : history_) {
+        double dt = (s.time - t0) - mean_t;
+        stt += dt * dt;
+        stx += dt * (s.x - mean_x);
+        stz += dt * (s.z - mean_z);
+    }
+    if (stt <= 0.0) {
+        return false;
+    }
+
+    vx = static_cast<float>(stx / stt);
+    vz = static_cast<float>(stz / stt);
+    return true;
+}
+
+const std::vector<uint32_t>& CameraPredictor::predict_regions(const RegionLookup& region_at) {
+    predicted_.clear();
+    if (history_.empty()) {
+        return predicted_;
+    }
+
+    const Sample& now = history_.back();
+    const uint32_t current = region_at(now.x, now.z);
+
+    // 1. 沿拟合速度外推，记录途经的Region
+    float vx = 0.0f, vz = 0.0f;
+    if (get_velocity(vx, vz) && std::sqrt(vx * vx + vz * vz) >= config_.min_speed) {
+        const uint32_t samples = std::max(1u, config_.path_samples);
+        for (uint32_t i = 1; i <= samples; ++i) {
+            float t = config_.horizon_seconds * static_cast<float>(i) / static_cast<float>(samples);
+            uint32_t region_id = region_at(now.x + vx * t, now.z + vz * t);
+            if (region_id != current) {
+                hold_until_[region_id] = now.time + config_.hold_seconds;
+            }
+        }
+    }
+
+    // 2. 仍在保留期内的Region都算作预测结果
+    for (auto it = hold_until_.begin(); it != hold_until_.end();) {
+        if (it->second < now.time) {
+            it = hold_until_.erase(it);
+            continue;
+        }
+        if (it->first != current) {
+            predicted_.push_back(it->first);
+        }
+        ++it;
+    }
+
+    return predicted_;
+}
+
+void CameraPredictor::clear() {
+    history_.clear();
+    hold_until_.clear();
+    predicted_.clear();
+}
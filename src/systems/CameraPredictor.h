@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <vector>
+
+// ============================================================
+// CameraPredictor - 基于相机速度的HQ预热预测
+// 记录最近一段时间的相机位置（XZ平面），用最小二乘拟合速度，
+// 沿速度方向外推horizon秒，途经的Region即为预计将变为HQ的Region。
+// 预测结果保留hold秒，避免相机抖动时预热Region反复转换。
+// ============================================================
+
+class CameraPredictor {
+public:
+    struct Config {
+        double history_seconds = 0.5;  // 拟合速度使用的历史窗口
+        float horizon_seconds = 3.0f;  // 外推时长
+        float min_speed = 2.0f;        // 低于该速度（单位/秒）视为静止，不预测
+        uint32_t path_samples = 4;     // 外推路径上的采样点数
+        double hold_seconds = 1.0;     // 预测命中后保留的时长
+    };
+
+    // 世界坐标(x, z) → Region ID
+    using RegionLookup = std::function<uint32_t(float x, float z)>;
+
+    CameraPredictor() = default;
+    explicit CameraPredictor(const Config& config) : config_(config) {}
+
+    void set_config(const Config& config) { config_ = config; }
+    const Config& get_config() const { return config_; }
+
+    // 记录一次相机位置（time为单调递增的秒数）
+    void add_sample(double time, float x, float z);
+
+    // 拟合得到的速度；样本不足时返回false
+    bool get_velocity(float& vx, float& vz) const;
+
+    // 预计将在horizon内到达的Region（按ID排序，不含相机当前所在Region）
+    const std::vector<uint32_t>& predict_regions(const RegionLookup& region_at);
+
+    void clear();
+
+private:
+    struct Sample {
+        double time;
+        float x;
+        float z;
+    };
+
+    static constexpr size_t kMinSamples = 3;
+
+    Config config_;
+    std::deque<Sample> history_;
+    std::map<uint32_t, double> hold_until_;  // Region → 预测保留截止时间
+    std::vector<uint32_t> predicted_;
+};
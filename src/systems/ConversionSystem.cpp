@@ -1,9 +1,13 @@
 #include "ConversionSystem.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <set>
 
 void ConversionSystem::update_region_modes() {
-    auto& registry = scheduler_.ctx_.get_registry();
+    if (budget_manager_) {
+        budget_manager_->allocate(scheduler_.ctx_.get_registry());
+    }
 
     // 遍历所有Region
     for (auto [region_id, _] : state_.get_all_regions()) {
@@ -14,53 +18,309 @@ void ConversionSystem::update_region_modes() {
         }
         auto& region = region_result.value().get();
 
-        // 如果当前模式与目标模式不同，执行转换
-        if (region.mode != region.target_mode) {
-            if (region.target_mode == Region::Mode::HQ) {
-                // LQ → HQ：为该Region的所有种群生成个体
-                std::cout << "\n=== Converting Region " << region_id << " (" << region.name
-                          << ") to HQ mode ===" << std::endl;
-
-                const auto& all_pops = registry.view<component::Population>();
-                for (EntityId pop_id : all_pops) {
-                    const auto& pop = registry.get_component<component::Population>(pop_id);
-
-                    if (pop.region_id == region_id &&
-                        pop.mode == component::Population::Mode::Simulated) {
-                        // 转换这个种群
-                        uint32_t spawn_count = std::min(pop.estimated_count, 150u);
-                        scheduler_.convert_lq_to_hq(pop_id, spawn_count);
-                    }
-                }
-
-                region.mode = Region::Mode::HQ;
+        if (region.mode == region.target_mode) {
+            continue;
+        }
+
+        const Region::Mode from = region.mode;
+        const Region::Mode to = region.target_mode;
+
+        // 预热 → HQ：个体已在后台生成，未完成的部分转到前台
+        if (from == Region::Mode::Warming && to == Region::Mode::HQ) {
+            std::cout << "\n=== Converting Region " << region_id << " (" << region.name
+                      << ") to HQ mode (pre-warmed) ===" << std::endl;
+            promote_warming_jobs(region_id);
+            set_region_mode(region_id, region, Region::Mode::HQ);
+            continue;
+        }
+
+        // HQ → 预热：相机刚离开但预计会返回，保留个体
+        if (from == Region::Mode::HQ && to == Region::Mode::Warming) {
+            demote_jobs(region_id);
+            set_region_mode(region_id, region, Region::Mode::Warming);
+            continue;
+        }
+
+        if (to == Region::Mode::Warming) {
+            std::cout << "\n=== Pre-warming Region " << region_id << " (" << region.name
+                      << ") ===" << std::endl;
+        } else {
+            std::cout << "\n=== Converting Region " << region_id << " (" << region.name
+                      << ") to " << region_mode_name(to) << " mode ===" << std::endl;
+        }
+
+        // 1. 离开当前模式
+        if (from == Region::Mode::HQ || from == Region::Mode::Warming) {
+            // 聚合该Region的所有物种并销毁个体
+            cancel_jobs(region_id);
+            aggregate_region(region_id);
+        } else if (from == Region::Mode::MQ) {
+            scheduler_.end_mq(region_id);
+        }
+
+        // 2. 进入目标模式
+        switch (to) {
+            case Region::Mode::HQ:
+                // 为该Region的所有种群创建生成任务
+                enqueue_region(region_id, jobs_);
+                break;
+            case Region::Mode::Warming:
+                enqueue_region(region_id, warming_jobs_);
+                break;
+            case Region::Mode::MQ:
+                scheduler_.begin_mq(region_id);
+                break;
+            case Region::Mode::LQ:
+                break;
+        }
+        set_region_mode(region_id, region, to);
+    }
+
+    if (budget_manager_) {
+        rebalance();
+    }
+
+    advance_jobs();
+}
+
+void ConversionSystem::set_region_mode(uint32_t region_id, Region& region, Region::Mode mode) {
+    scheduler_.ctx_.record(effect::RegionChanged{
+        region_id, core::sym::RegionMode, static_cast<float>(region.mode), static_cast<float>(mode)
+    });
+    region.mode = mode;
+}
+
+void ConversionSystem::enqueue_region(uint32_t region_id, std::deque<SpawnJob>& queue) {
+    auto& registry = scheduler_.ctx_.get_registry();
+
+    const auto& all_pops = registry.view<component::Population>();
+    for (EntityId pop_id : all_pops) {
+        const auto& pop = registry.get_component<component::Population>(pop_id);
+
+        if (pop.region_id == region_id &&
+            pop.mode == component::Population::Mode::Simulated) {
+            // 转换这个种群
+            uint32_t spawn_count = spawn_target(pop_id, pop);
+            scheduler_.begin_lq_to_hq(pop_id);
+            queue.push_back({pop_id, region_id, spawn_count});
+        }
+    }
+}
+
+void ConversionSystem::promote_warming_jobs(uint32_t region_id) {
+    // 保持该Region各任务的相对顺序，整体放到前台队列最前面
+    std::deque<SpawnJob> promoted;
+    for (const auto& job : warming_jobs_) {
+        if (job.region_id == region_id) {
+            promoted.push_back(job);
+        }
+    }
+    jobs_.insert(jobs_.begin(), promoted.begin(), promoted.end());
+
+    warming_jobs_.erase(std::remove_if(warming_jobs_.begin(), warming_jobs_.end(), [region_id](const SpawnJob& job) {
+        return job.region_id == region_id;
+    }), warming_jobs_.end());
+}
+
+void ConversionSystem::demote_jobs(uint32_t region_id) {
+    // 保持该Region各任务的相对顺序，追加到预热队列末尾
+    for (const auto& job : jobs_) {
+        if (job.region_id == region_id) {
+            warming_jobs_.push_back(job);
+        }
+    }
+
+    jobs_.erase(std::remove_if(jobs_.begin(), jobs_.end(), [region_id](const SpawnJob& job) {
+        return job.region_id == region_id;
+    }), jobs_.end());
+}
+
+void ConversionSystem::aggregate_region(uint32_t region_id) {
+    auto& registry = scheduler_.ctx_.get_registry();
+
+    // 找出该Region有哪些物种（包括转换未完成、尚无个体的种群）
+    std::set<SpeciesId> species_in_region;
+    const auto& all_creatures = registry.view<component::SpeciesRef>();
+
+    for (EntityId cid : all_creatures) {
+        if (registry.has_component<component::Position>(cid)) {
+            const auto& pos = registry.get_component<component::Position>(cid);
+            if (pos.region_id == region_id) {
+                const auto& species_ref = registry.get_component<component::SpeciesRef>(cid);
+                species_in_region.insert(species_ref.species_id);
             }
-            else {
-                // HQ → LQ：聚合该Region的所有物种并销毁个体
-                std::cout << "\n=== Converting Region " << region_id << " (" << region.name
-                          << ") to LQ mode ===" << std::endl;
-
-                // 找出该Region有哪些物种
-                std::set<SpeciesId> species_in_region;
-                const auto& all_creatures = registry.view<component::SpeciesRef>();
-
-                for (EntityId cid : all_creatures) {
-                    if (registry.has_component<component::Position>(cid)) {
-                        const auto& pos = registry.get_component<component::Position>(cid);
-                        if (pos.region_id == region_id) {
-                            const auto& species_ref = registry.get_component<component::SpeciesRef>(cid);
-                            species_in_region.insert(species_ref.species_id);
-                        }
-                    }
-                }
-
-                // 对每个物种执行HQ→LQ转换
-                for (SpeciesId sid : species_in_region) {
-                    scheduler_.convert_hq_to_lq(region_id, sid);
-                }
-
-                region.mode = Region::Mode::LQ;
+        }
+    }
+
+    for (EntityId pop_id : registry.view<component::Population>()) {
+        const auto& pop = registry.get_component<component::Population>(pop_id);
+        if (pop.region_id == region_id &&
+            pop.mode != component::Population::Mode::Simulated) {
+            species_in_region.insert(pop.species_id);
+        }
+    }
+
+    // 对每个物种执行HQ→LQ转换
+    for (SpeciesId sid : species_in_region) {
+        scheduler_.convert_hq_to_lq(region_id, sid);
+    }
+}
+
+uint32_t ConversionSystem::spawn_target(EntityId pop_id, const component::Population& pop) const {
+    if (budget_manager_) {
+        return std::min(pop.estimated_count, budget_manager_->get_population_quota(pop_id));
+    }
+    return std::min(pop.estimated_count, kMaxSpawnPerPopulation);
+}
+
+ConversionSystem::SpawnJob* ConversionSystem::find_job(std::deque<SpawnJob>& queue, EntityId pop_id) {
+    for (auto& job : queue) {
+        if (job.pop_id == pop_id) {
+            return &job;
+        }
+    }
+    return nullptr;
+}
+
+void ConversionSystem::rebalance() {
+    auto& registry = scheduler_.ctx_.get_registry();
+
+    for (EntityId pop_id : registry.view<component::Population>()) {
+        const auto& pop = registry.get_component<component::Population>(pop_id);
+        if (pop.mode == component::Population::Mode::Simulated) {
+            continue;
+        }
+
+        auto region_result = state_.get_region(pop.region_id);
+        if (region_result.is_err()) {
+            continue;
+        }
+        const bool warming = region_result.value().get().mode == Region::Mode::Warming;
+
+        // 任务可能仍在另一个队列中（模式切换后尚未迁移），两个队列都要查找，避免重复建任务
+        SpawnJob* job = find_job(jobs_, pop_id);
+        if (!job) {
+            job = find_job(warming_jobs_, pop_id);
+        }
+
+        // 存活 + 排队中的数量与目标比较（已死亡的个体不再占用预算）
+        const process::GeneMoments* moments = scheduler_.ctx_.get_gene_stats().find(pop.region_id, pop.species_id);
+        const uint32_t alive = moments ? moments->count() : 0;
+        const uint32_t target = spawn_target(pop_id, pop);
+        const uint32_t pending = job ? job->remaining : 0;
+        const uint32_t have = alive + pending;
+
+        if (have < target) {
+            // 增加：只能从LQ余量中补充（死亡个体仍计入individual_count，不会退回余量）
+            const uint32_t remainder = pop.estimated_count > pop.individual_count
+                ? pop.estimated_count - pop.individual_count : 0;
+            const uint32_t add = std::min(target - have, remainder > pending ? remainder - pending : 0u);
+            if (add == 0) {
+                continue;
+            }
+            // 追加到已有任务或新建任务
+            if (job) {
+                job->remaining += add;
+            } else {
+                (warming ? warming_jobs_ : jobs_).push_back({pop_id, pop.region_id, add});
+            }
+        } else if (have > target) {
+            // 减少：先削减排队中的数量，不足的部分销毁已有个体
+            uint32_t excess = have - target;
+            if (job) {
+                uint32_t cut = std::min(excess, job->remaining);
+                job->remaining -= cut;
+                excess -= cut;
+            }
+            if (excess > 0) {
+                scheduler_.despawn_batch(pop_id, excess);
+            }
+        }
+    }
+}
+
+template<typename OutOfTime>
+uint32_t ConversionSystem::run_queue(std::deque<SpawnJob>& queue, uint32_t spawn_limit, OutOfTime out_of_time) {
+    uint32_t spawned_total = 0;
+
+    while (!queue.empty()) {
+        auto& job = queue.front();
+
+        // 1. 本次生成数量：剩余量、个体数上限、计时检查粒度三者取最小
+        uint32_t count = std::min(job.remaining, kMaxBatch);
+        if (spawn_limit > 0) {
+            if (spawned_total >= spawn_limit) {
+                break;
             }
+            count = std::min(count, spawn_limit - spawned_total);
+        }
+        if (budget_.max_microseconds > 0) {
+            count = std::min(count, kSpawnChunk);
+        }
+
+        // 2. 生成（LQ余量不足时实际数量可能更少，此时任务结束）
+        uint32_t spawned = count > 0 ? scheduler_.spawn_batch(job.pop_id, count) : 0;
+        spawned_total += spawned;
+        job.remaining = spawned < count ? 0 : job.remaining - spawned;
+
+        if (job.remaining == 0) {
+            scheduler_.finish_lq_to_hq(job.pop_id);
+            queue.pop_front();
+        }
+
+        if (out_of_time()) {
+            break;
+        }
+    }
+
+    return spawned_total;
+}
+
+void ConversionSystem::advance_jobs() {
+    spawned_last_frame_ = 0;
+    if (jobs_.empty() && warming_jobs_.empty()) {
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto out_of_time = [&]() {
+        if (budget_.max_microseconds == 0) {
+            return false;
         }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        return elapsed >= static_cast<long long>(budget_.max_microseconds);
+    };
+
+    // 1. 前台任务（相机所在Region）
+    spawned_last_frame_ = run_queue(jobs_, budget_.max_spawns_per_frame, out_of_time);
+    if (!jobs_.empty() || out_of_time()) {
+        return;
+    }
+
+    // 2. 预热任务只使用剩余预算
+    uint32_t warming_limit = budget_.max_warming_spawns_per_frame;
+    if (budget_.max_spawns_per_frame > 0) {
+        uint32_t left = budget_.max_spawns_per_frame - std::min(spawned_last_frame_, budget_.max_spawns_per_frame);
+        if (left == 0) {
+            return;
+        }
+        warming_limit = warming_limit > 0 ? std::min(warming_limit, left) : left;
+    }
+    spawned_last_frame_ += run_queue(warming_jobs_, warming_limit, out_of_time);
+}
+
+void ConversionSystem::cancel_jobs(uint32_t region_id) {
+    // 已生成的个体与LQ余量由HQ→LQ聚合合并回种群
+    auto in_region = [region_id](const SpawnJob& job) { return job.region_id == region_id; };
+    jobs_.erase(std::remove_if(jobs_.begin(), jobs_.end(), in_region), jobs_.end());
+    warming_jobs_.erase(std::remove_if(warming_jobs_.begin(), warming_jobs_.end(), in_region), warming_jobs_.end());
+}
+
+uint32_t ConversionSystem::pending_in(const std::deque<SpawnJob>& queue) {
+    uint32_t total = 0;
+    for (const auto& job : queue) {
+        total += job.remaining;
     }
+    return total;
 }
@@ -1,22 +1,103 @@
 #pragma once
 
 #include "process/ProcessScheduler.h"
+#include "systems/HqBudgetManager.h"
 #include "simulation/SimulationState.h"
+#include <cstdint>
+#include <deque>
 
 // ============================================================
 // ConversionSystem - HQ/LQ模式转换系统
 // 基于Region的target_mode进行转换
+// LQ→HQ的个体生成是分帧任务：每帧按预算（个体数/微秒）生成一部分，
+// 避免相机跨越Region边界时在一帧内生成所有个体造成卡顿。
+// 预计即将变为HQ的Region（target_mode == Warming）提前在后台生成个体，
+// 只使用前台任务剩余的预算；相机到达时只需切换模式标记。
+// 中距离Region（MQ）不生成个体，只为种群附加少量代表个体样本。
+// 设置了HqBudgetManager时，各种群的个体数由全局预算分配，并随分配结果逐帧增减。
 // ============================================================
 
 class ConversionSystem {
 public:
+    // 每帧的生成预算（0表示不限制；两者都为0时在当帧完成转换）
+    struct Budget {
+        uint32_t max_spawns_per_frame = 0;
+        uint32_t max_microseconds = 0;
+        uint32_t max_warming_spawns_per_frame = 0;  // 预热任务每帧的额外上限
+    };
+
     ConversionSystem(process::ProcessScheduler& scheduler, SimulationState& state)
         : scheduler_(scheduler), state_(state) {}
 
-    // 检查所有Region并触发HQ/LQ转换（基于target_mode）
+    // 检查所有Region并触发HQ/LQ转换（基于target_mode），然后按预算推进生成任务
     void update_region_modes();
 
+    void set_budget(const Budget& budget) { budget_ = budget; }
+    const Budget& get_budget() const { return budget_; }
+
+    // 全局HQ预算（nullptr表示每个种群固定最多kMaxSpawnPerPopulation个）
+    void set_budget_manager(HqBudgetManager* manager) { budget_manager_ = manager; }
+
+    // 尚未生成的个体数（前台/预热） / 本帧生成的个体数（含预热）
+    uint32_t get_pending_spawns() const { return pending_in(jobs_); }
+    uint32_t get_pending_warming_spawns() const { return pending_in(warming_jobs_); }
+    uint32_t get_spawned_last_frame() const { return spawned_last_frame_; }
+    bool is_converting() const { return !jobs_.empty(); }
+
 private:
+    // 单个种群的生成任务
+    struct SpawnJob {
+        EntityId pop_id;
+        uint32_t region_id;
+        uint32_t remaining;
+    };
+
+    // 切换Region模式并记录RegionChanged（回放据此恢复模式）
+    void set_region_mode(uint32_t region_id, Region& region, Region::Mode mode);
+
+    // 为Region中仍为LQ的种群开始转换并把生成任务加入队列
+    void enqueue_region(uint32_t region_id, std::deque<SpawnJob>& queue);
+
+    // 预热完成前相机已到达：把该Region的预热任务提到前台队列最前面
+    void promote_warming_jobs(uint32_t region_id);
+
+    // 相机离开但预计会返回：把该Region未完成的前台任务移回预热队列（只使用剩余预算）
+    void demote_jobs(uint32_t region_id);
+
+    // 聚合Region的所有物种并销毁个体
+    void aggregate_region(uint32_t region_id);
+
+    // 种群应有的个体数
+    uint32_t spawn_target(EntityId pop_id, const component::Population& pop) const;
+
+    // 按预算分配结果增减HQ/预热Region中各种群的个体
+    void rebalance();
+
+    // 查找某种群的生成任务（不存在时返回nullptr）
+    static SpawnJob* find_job(std::deque<SpawnJob>& queue, EntityId pop_id);
+
+    // 按预算推进生成任务：先前台，剩余预算再给预热任务
+    void advance_jobs();
+
+    // 推进一个队列，最多生成spawn_limit个（0表示不限制），返回生成数
+    template<typename OutOfTime>
+    uint32_t run_queue(std::deque<SpawnJob>& queue, uint32_t spawn_limit, OutOfTime out_of_time);
+
+    // 取消某Region尚未完成的任务（切回LQ时）
+    void cancel_jobs(uint32_t region_id);
+
+    static uint32_t pending_in(const std::deque<SpawnJob>& queue);
+
+    static constexpr uint32_t kMaxSpawnPerPopulation = 150;
+    static constexpr uint32_t kSpawnChunk = 16;  // 计时预算的检查粒度
+    static constexpr uint32_t kMaxBatch = 200;   // SpawnCreaturesFromPopulation单次生成上限
+
     process::ProcessScheduler& scheduler_;
     SimulationState& state_;
+
+    Budget budget_;
+    HqBudgetManager* budget_manager_ = nullptr;
+    std::deque<SpawnJob> jobs_;
+    std::deque<SpawnJob> warming_jobs_;
+    uint32_t spawned_last_frame_ = 0;
 };
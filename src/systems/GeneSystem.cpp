@@ -1,6 +1,7 @@
 #include "systems/GeneSystem.h"
+#include "core/Random.h"
+#include <algorithm>
 #include <cmath>
-#include <random>
 
 namespace systems {
 
@@ -29,12 +30,11 @@ AppearanceGene GeneSystem::BuildAppearanceFromGameplay(
     
     // ========== 纯视觉随机字段（不影响逻辑） ==========
     
-    std::mt19937 rng(appearance.seed);
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    core::CounterRng rng(appearance.seed, appearance.species_id, core::RngStream::Appearance);
     
-    appearance.base_tone = dist(rng);          // 皮肤/毛发颜色
-    appearance.pattern_variation = dist(rng);  // 花纹变化
-    appearance.scar_level = dist(rng);         // 伤疤程度
+    appearance.base_tone = rng.next_float();          // 皮肤/毛发颜色
+    appearance.pattern_variation = rng.next_float();  // 花纹变化
+    appearance.scar_level = rng.next_float();         // 伤疤程度
     
     // style_tags可以由势力/职业决定（未来扩展）
     // 这里留空
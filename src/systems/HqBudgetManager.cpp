@@ -0,0 +1,94 @@
+#include "HqBudgetManager.h"
+#include "components/Components.h"
+#include <algorithm>
+#include <numeric>
+
+void HqBudgetManager::request(uint32_t region_id, const HqRegionPriority& priority) {
+    for (auto& existing : requests_) {
+        if (existing.region_id == region_id) {
+            // 同一Region被多次请求（多个观察者）：取最近距离、任一可见、最高重要度
+            existing.priority.distance = std::min(existing.priority.distance, priority.distance);
+            existing.priority.visible = existing.priority.visible || priority.visible;
+            existing.priority.importance = std::max(existing.priority.importance, priority.importance);
+            return;
+        }
+    }
+    requests_.push_back({region_id, priority});
+}
+
+bool HqBudgetManager::is_requested(uint32_t region_id) const {
+    return std::any_of(requests_.begin(), requests_.end(), [region_id](const Request& r) {
+        return r.region_id == region_id;
+    });
+}
+
+float HqBudgetManager::score(const HqRegionPriority& priority) const {
+    float visibility = priority.visible ? 1.0f : config_.hidden_factor;
+    float falloff = 1.0f + std::max(0.0f, priority.distance) / std::max(1.0f, config_.distance_scale);
+    return std::max(0.0f, priority.importance) * visibility / falloff;
+}
+
+void HqBudgetManager::allocate(const ecs::Registry& registry) {
+    quotas_.clear();
+    region_slots_.clear();
+    allocated_ = 0;
+
+    // 1. 优先级从高到低（同分按Region ID，保证确定性）
+    std::sort(requests_.begin(), requests_.end(), [this](const Request& a, const Request& b) {
+        float sa = score(a.priority), sb = score(b.priority);
+        return sa != sb ? sa > sb : a.region_id < b.region_id;
+    });
+
+    uint32_t remaining = config_.total_slots;
+    const auto& all_pops = registry.view<component::Population>();
+
+    for (const auto& req : requests_) {
+        // 2. 该Region各种群的需求
+        pops_scratch_.clear();
+        demand_scratch_.clear();
+        for (EntityId pop_id : all_pops) {
+            const auto& pop = registry.get_component<component::Population>(pop_id);
+            if (pop.region_id == req.region_id) {
+                pops_scratch_.push_back(pop_id);
+                demand_scratch_.push_back(std::min(pop.estimated_count, config_.max_per_population));
+            }
+        }
+
+        uint64_t demand = std::accumulate(demand_scratch_.begin(), demand_scratch_.end(), uint64_t{0});
+        uint32_t slots = static_cast<uint32_t>(std::min<uint64_t>(demand, remaining));
+        region_slots_[req.region_id] = slots;
+        remaining -= slots;
+        allocated_ += slots;
+        if (slots == 0) {
+            for (EntityId pop_id : pops_scratch_) {
+                quotas_[pop_id] = 0;
+            }
+            continue;
+        }
+
+        // 3. 按需求比例分到各种群，余数按种群顺序补齐
+        uint32_t assigned = 0;
+        for (size_t i = 0; i < pops_scratch_.size(); ++i) {
+            uint32_t quota = static_cast<uint32_t>(uint64_t{slots} * demand_scratch_[i] / demand);
+            quotas_[pops_scratch_[i]] = quota;
+            assigned += quota;
+        }
+        for (size_t i = 0; i < pops_scratch_.size() && assigned < slots; ++i) {
+            uint32_t& quota = quotas_[pops_scratch_[i]];
+            if (quota < demand_scratch_[i]) {
+                ++quota;
+                ++assigned;
+            }
+        }
+    }
+}
+
+uint32_t HqBudgetManager::get_population_quota(EntityId pop_id) const {
+    auto it = quotas_.find(pop_id);
+    return it != quotas_.end() ? it->second : 0;
+}
+
+uint32_t HqBudgetManager::get_region_slots(uint32_t region_id) const {
+    auto it = region_slots_.find(region_id);
+    return it != region_slots_.end() ? it->second : 0;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ecs/Registry.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================
+// HqBudgetManager - 全局HQ个体预算
+// 多个Region同时为HQ时（分屏、多玩家、广视角），按优先级把有限的
+// 个体名额分配给各Region：优先级高的Region先满足需求，剩余名额再给下一个。
+// Region内按种群估计数量比例分配到各种群，ConversionSystem据此增减个体。
+// ============================================================
+
+// Region的HQ优先级因素
+struct HqRegionPriority {
+    float distance = 0.0f;     // 到最近观察者的距离
+    bool visible = true;       // 是否在任一视野内
+    float importance = 1.0f;   // 玩法重要度（任务目标、战斗区域等）
+};
+
+class HqBudgetManager {
+public:
+    struct Config {
+        uint32_t total_slots = 600;          // 所有HQ Region的个体总数上限
+        uint32_t max_per_population = 150;   // 单个种群的个体上限
+        float distance_scale = 100.0f;       // 距离衰减尺度
+        float hidden_factor = 0.25f;         // 不可见Region的优先级系数
+    };
+
+    HqBudgetManager() = default;
+    explicit HqBudgetManager(const Config& config) : config_(config) {}
+
+    void set_config(const Config& config) { config_ = config; }
+    const Config& get_config() const { return config_; }
+
+    // 每帧重新提交需要个体模拟的Region
+    void clear_requests() { requests_.clear(); }
+    void request(uint32_t region_id, const HqRegionPriority& priority);
+    bool is_requested(uint32_t region_id) const;
+
+    // 按优先级分配名额（需求为各种群估计数量，受max_per_population限制）
+    void allocate(const ecs::Registry& registry);
+
+    // 分配结果：种群的个体名额 / Region的名额 / 已分配总数
+    uint32_t get_population_quota(EntityId pop_id) const;
+    uint32_t get_region_slots(uint32_t region_id) const;
+    uint32_t get_allocated() const { return allocated_; }
+
+    float score(const HqRegionPriority& priority) const;
+
+private:
+    struct Request {
+        uint32_t region_id;
+        HqRegionPriority priority;
+    };
+
+    Config config_;
+    std::vector<Request> requests_;
+
+    std::unordered_map<EntityId, uint32_t> quotas_;
+    std::unordered_map<uint32_t, uint32_t> region_slots_;
+    uint32_t allocated_ = 0;
+
+    // 复用的缓冲
+    std::vector<EntityId> pops_scratch_;
+    std::vector<uint32_t> demand_scratch_;
+};
@@ -4,3 +4,19 @@ void PopulationSystem::update(float dt) {
     // 执行所有种群增长Process
     scheduler_.execute_all_population_growth(dt);
 }
+
+void PopulationSystem::update_regions(const std::vector<RegionTick>& ticks) {
+    scheduler_.execute_population_growth_in_regions(ticks);
+}
+
+void PopulationSystem::update_food(float dt) {
+    scheduler_.execute_food_dynamics(dt);
+}
+
+void PopulationSystem::update_migration(float dt) {
+    scheduler_.execute_population_migration(dt);
+}
+
+void PopulationSystem::update_samples(float dt) {
+    scheduler_.execute_representative_samples(dt);
+}
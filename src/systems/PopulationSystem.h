@@ -14,6 +14,18 @@ public:
     // 主更新循环
     void update(float dt);
 
+    // 多速率更新：只更新本步到期的Region（由RegionTickScheduler规划）
+    void update_regions(const std::vector<RegionTick>& ticks);
+
+    // Region食物恢复与消耗（在种群增长之前执行，增长读取实时食物）
+    void update_food(float dt);
+
+    // LQ种群在相邻Region间迁移（每步对整个大陆执行一次，不受多速率调度影响）
+    void update_migration(float dt);
+
+    // MQ区域的代表个体样本（每步更新，不受多速率调度影响）
+    void update_samples(float dt);
+
 private:
     process::ProcessScheduler& scheduler_;
 };
@@ -0,0 +1,70 @@
+#include "RegionCreatureIndex.h"
+#include "components/Components.h"
+
+void RegionCreatureIndex::attach(ecs::EffectBus& bus, const ecs::Registry& registry) {
+    registry_ = &registry;
+
+    // 分发时已是tick结束的状态：同一tick内创建又销毁的个体已不存在，
+    // 创建后又迁移的个体直接读到迁移后的Region
+    bus.subscribe<effect::ComponentAdded>([this](std::span<const effect::ComponentAdded> added) {
+        for (const auto& e : added) {
+            if (e.component_type != core::sym::Position ||
+                !registry_->has_component<component::Position>(e.entity_id) ||
+                !registry_->has_component<component::SpeciesRef>(e.entity_id)) {
+                continue;
+            }
+            insert(e.entity_id, registry_->get_component<component::Position>(e.entity_id).region_id);
+        }
+    });
+
+    bus.subscribe<effect::Migration>([this](std::span<const effect::Migration> migrations) {
+        for (const auto& e : migrations) {
+            if (locations_.count(e.entity_id)) {
+                insert(e.entity_id, e.to_region);
+            }
+        }
+    });
+
+    bus.subscribe<effect::EntityDestroyed>([this](std::span<const effect::EntityDestroyed> destroyed) {
+        for (const auto& e : destroyed) {
+            erase(e.entity_id);
+        }
+    });
+}
+
+const std::vector<EntityId>& RegionCreatureIndex::creatures_in(uint32_t region_id) const {
+    static const std::vector<EntityId> empty;
+    auto it = regions_.find(region_id);
+    return it != regions_.end() ? it->second : empty;
+}
+
+void RegionCreatureIndex::insert(EntityId id, uint32_t region_id) {
+    auto it = locations_.find(id);
+    if (it != locations_.end()) {
+        if (it->second.region_id == region_id) {
+            return;
+        }
+        erase(id);
+    }
+
+    auto& list = regions_[region_id];
+    locations_[id] = Location{region_id, list.size()};
+    list.push_back(id);
+}
+
+void RegionCreatureIndex::erase(EntityId id) {
+    auto it = locations_.find(id);
+    if (it == locations_.end()) {
+        return;
+    }
+
+    // 与末尾交换后删除
+    auto& list = regions_[it->second.region_id];
+    size_t index = it->second.index;
+    if (index != list.size() - 1) {
+        list[index] = list.back();
+        locations_[list[index]].index = index;
+    }
+    list.pop_back();
+    locations_.erase(it);
+}
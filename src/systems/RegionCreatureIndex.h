@@ -0,0 +1,39 @@
+#pragma once
+
+#include "ecs/Registry.h"
+#include "process/EffectBus.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================
+// RegionCreatureIndex - 按Region索引的个体列表
+// 订阅Effect总线增量维护（Position添加 / 迁移 / 销毁），
+// 查询某Region的个体时不再遍历所有Position组件。
+// ============================================================
+
+class RegionCreatureIndex {
+public:
+    RegionCreatureIndex() = default;
+
+    // 订阅总线（registry用于读取新个体的Position）
+    void attach(ecs::EffectBus& bus, const ecs::Registry& registry);
+
+    // 指定Region的个体（顺序不保证）
+    const std::vector<EntityId>& creatures_in(uint32_t region_id) const;
+
+    size_t size() const { return locations_.size(); }
+
+private:
+    void insert(EntityId id, uint32_t region_id);
+    void erase(EntityId id);
+
+    struct Location {
+        uint32_t region_id;
+        size_t index;  // 在该Region列表中的下标
+    };
+
+    const ecs::Registry* registry_ = nullptr;
+    std::unordered_map<uint32_t, std::vector<EntityId>> regions_;
+    std::unordered_map<EntityId, Location> locations_;
+};
@@ -0,0 +1,126 @@
+#include "RegionTickScheduler.h"
+#include <algorithm>
+#include <climits>
+#include <numeric>
+
+void RegionTickScheduler::set_region_distance(uint32_t region_id, float distance) {
+    auto& slot = slots_[region_id];
+    slot.distance = distance;
+    slot.period = period_for_distance(distance);
+}
+
+void RegionTickScheduler::set_config(const Config& config) {
+    config_ = config;
+    for (auto& [region_id, slot] : slots_) {
+        slot.period = period_for_distance(slot.distance);
+    }
+}
+
+uint32_t RegionTickScheduler::period_for_distance(float distance) const {
+    if (distance <= config_.full_rate_distance || config_.band_width <= 0.0f) {
+        return 1;
+    }
+
+    // 每超出一个带宽周期翻倍：1, 2, 4, 8...
+    uint32_t bands = static_cast<uint32_t>((distance - config_.full_rate_distance) / config_.band_width) + 1;
+    uint32_t period = 1;
+    for (uint32_t i = 0; i < bands && period < config_.max_period; ++i) {
+        period *= 2;
+    }
+    return std::min(period, std::max(1u, config_.max_period));
+}
+
+uint32_t RegionTickScheduler::effective_period(const Region& region, const RegionSlot& slot) {
+    // HQ/预热区域每步更新，LQ和MQ按距离降频
+    bool population_level = region.mode == Region::Mode::LQ || region.mode == Region::Mode::MQ;
+    return population_level ? slot.period : 1;
+}
+
+void RegionTickScheduler::assign_phases(const SimulationState& state) {
+    // 1. 各Region本步的周期，以及所有周期的最小公倍数（之后的更新模式按此循环）
+    phase_order_.clear();
+    uint32_t horizon = 1;
+    for (const auto& [region_id, region] : state.get_all_regions()) {
+        uint32_t period = effective_period(region, slots_[region_id]);
+        horizon = std::lcm(horizon, period);
+        phase_order_.push_back({period, region_id});
+    }
+
+    // 2. 周期短的Region先放（长周期的Region更新稀疏，最后填补空档），
+    //    每个选使其各更新步上已有负载的最大值最小的相位；
+    //    只由周期和Region ID决定，周期不变时每步结果相同，周期变化后重新错开
+    std::sort(phase_order_.begin(), phase_order_.end(), [](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first < b.first : a.second < b.second;
+    });
+
+    phase_load_.assign(horizon, 0);
+    for (const auto& [period, region_id] : phase_order_) {
+        // 相位phase的Region在 (step + phase) % period == 0 的步更新，即 step ≡ (period - phase) % period
+        uint32_t best_phase = 0;
+        uint32_t best_peak = UINT32_MAX;
+        for (uint32_t phase = 0; phase < period; ++phase) {
+            uint32_t peak = 0;
+            for (uint32_t step = (period - phase) % period; step < horizon; step += period) {
+                peak = std::max(peak, phase_load_[step]);
+            }
+            if (peak < best_peak) {
+                best_peak = peak;
+                best_phase = phase;
+            }
+        }
+
+        slots_[region_id].phase = best_phase;
+        for (uint32_t step = (period - best_phase) % period; step < horizon; step += period) {
+            ++phase_load_[step];
+        }
+    }
+}
+
+uint32_t RegionTickScheduler::get_min_recent_updates() const {
+    if (recent_updates_.empty()) {
+        return 0;
+    }
+    size_t n = std::min<uint64_t>(recent_updates_.size(), step_index_);
+    return *std::min_element(recent_updates_.begin(), recent_updates_.begin() + n);
+}
+
+uint32_t RegionTickScheduler::get_max_recent_updates() const {
+    if (recent_updates_.empty()) {
+        return 0;
+    }
+    size_t n = std::min<uint64_t>(recent_updates_.size(), step_index_);
+    return *std::max_element(recent_updates_.begin(), recent_updates_.begin() + n);
+}
+
+uint32_t RegionTickScheduler::get_period(uint32_t region_id) const {
+    auto it = slots_.find(region_id);
+    return it == slots_.end() ? 1 : it->second.period;
+}
+
+const std::vector<RegionTick>& RegionTickScheduler::plan(const SimulationState& state, float base_dt) {
+    ticks_.clear();
+
+    assign_phases(state);
+
+    for (const auto& [region_id, region] : state.get_all_regions()) {
+        auto& slot = slots_[region_id];
+        uint32_t period = effective_period(region, slot);
+
+        slot.pending_dt += base_dt;
+
+        if ((step_index_ + slot.phase) % period == 0) {
+            ticks_.push_back(RegionTick{region_id, slot.pending_dt});
+            slot.pending_dt = 0.0f;
+        }
+    }
+
+    updates_last_step_ = static_cast<uint32_t>(ticks_.size());
+    recent_updates_.resize(std::max(1u, config_.max_period), 0);
+    recent_updates_[step_index_ % recent_updates_.size()] = updates_last_step_;
+    full_sweep_last_step_ = static_cast<uint32_t>(state.get_all_regions().size());
+    total_updates_ += updates_last_step_;
+    total_full_sweep_ += full_sweep_last_step_;
+    ++step_index_;
+
+    return ticks_;
+}
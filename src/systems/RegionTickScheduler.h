@@ -0,0 +1,80 @@
+#pragma once
+
+#include "simulation/SimulationState.h"
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+// ============================================================
+// RegionTickScheduler - 多速率Region调度
+// 每个Region按与相机的距离得到更新周期（1, 2, 4, ...步），
+// 远处Region以更低频率、更大dt积分；各Region按相位错开，
+// 使每步的更新数量保持平稳
+// ============================================================
+
+class RegionTickScheduler {
+public:
+    struct Config {
+        float full_rate_distance = 120.0f;  // 该距离内每步都更新
+        float band_width = 60.0f;           // 每超出一个带宽，周期翻倍
+        uint32_t max_period = 8;            // 最长更新周期（步）
+    };
+
+    RegionTickScheduler() = default;
+    explicit RegionTickScheduler(const Config& config) : config_(config) {}
+
+    // 更新Region到相机的距离（由渲染层提供），重新计算其更新周期
+    void set_region_distance(uint32_t region_id, float distance);
+
+    // 规划本步要更新的Region
+    // base_dt为固定步长；未到期的Region累积dt，到期时一次性积分
+    // HQ/预热区域总是每步更新（LQ和MQ按距离降频）
+    const std::vector<RegionTick>& plan(const SimulationState& state, float base_dt);
+
+    // 查询Region当前的更新周期（步）
+    uint32_t get_period(uint32_t region_id) const;
+
+    // ========== 统计 ==========
+    uint32_t get_updates_last_step() const { return updates_last_step_; }
+    uint32_t get_full_sweep_last_step() const { return full_sweep_last_step_; }  // 全量更新时的Region数
+    uint64_t get_total_updates() const { return total_updates_; }
+    uint64_t get_total_full_sweep() const { return total_full_sweep_; }
+    // 最近max_period步（一个最长周期）内每步更新数的最小/最大值，用于确认错开相位后负载平稳
+    // （周期变化后的一个周期内包含过渡）
+    uint32_t get_min_recent_updates() const;
+    uint32_t get_max_recent_updates() const;
+
+    const Config& get_config() const { return config_; }
+    // 更换距离分带后，已登记Region的周期按新配置重新计算
+    void set_config(const Config& config);
+
+private:
+    struct RegionSlot {
+        float distance = 0.0f;
+        uint32_t period = 1;
+        uint32_t phase = 0;
+        float pending_dt = 0.0f;
+    };
+
+    uint32_t period_for_distance(float distance) const;
+
+    // 本步实际使用的周期（HQ/预热为1）
+    static uint32_t effective_period(const Region& region, const RegionSlot& slot);
+
+    // 为所有Region分配相位，使一个循环内每步的更新数尽量平均
+    void assign_phases(const SimulationState& state);
+
+    Config config_;
+    std::map<uint32_t, RegionSlot> slots_;
+    std::vector<RegionTick> ticks_;
+    std::vector<std::pair<uint32_t, uint32_t>> phase_order_;  // (周期, Region ID)，相位分配顺序（复用）
+    std::vector<uint32_t> phase_load_;                        // 一个循环内每步已分配的更新数（复用）
+    std::vector<uint32_t> recent_updates_;  // 最近各步的更新数（环形，按step_index_取模）
+    uint64_t step_index_ = 0;
+
+    uint32_t updates_last_step_ = 0;
+    uint32_t full_sweep_last_step_ = 0;
+    uint64_t total_updates_ = 0;
+    uint64_t total_full_sweep_ = 0;
+};
@@ -0,0 +1,104 @@
+#include "tools/ParallelLifecycleValidation.h"
+#include "ecs/Registry.h"
+#include "process/ProcessScheduler.h"
+#include "components/Components.h"
+#include "core/Random.h"
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kCreatures = 100000;
+constexpr uint32_t kSteps = 40;
+
+// 独立的小世界：只有Lifecycle组件的个体，年龄、饥饿、健康分布使每步都有个体死亡
+struct LifecycleWorld {
+    ecs::Registry registry;
+    ecs::EffectRecorder recorder;
+    SimulationState state;
+    ProcessContext ctx;
+    process::ProcessScheduler scheduler;
+
+    explicit LifecycleWorld(uint32_t workers)
+        : ctx(registry, recorder, state), scheduler(ctx) {
+        state.initialize();
+        scheduler.set_worker_count(workers);
+
+        for (uint32_t i = 0; i < kCreatures; ++i) {
+            EntityId id = registry.create_entity(EntityType::Creature);
+            core::CounterRng rng(state.world_seed, id, core::RngStream::Lifecycle);
+            float lifespan = rng.uniform(200.0f, 400.0f);
+            registry.add_component(id, component::Lifecycle{
+                rng.uniform(0.0f, lifespan),
+                lifespan,
+                rng.uniform(0.0f, 0.9f),
+                rng.uniform(0.0f, 1.0f) < 0.01f ? 0.01f : 1.0f
+            });
+        }
+    }
+
+    // 执行一步，返回本步Effect流的文本形式
+    std::string step(double& elapsed_us) {
+        recorder.clear();
+        auto t0 = std::chrono::steady_clock::now();
+        scheduler.execute_all_creature_lifecycle(1.0f);
+        elapsed_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+
+        std::string stream;
+        recorder.for_each_ordered([&](const auto& e) {
+            stream += ecs::EffectRecorder::effect_to_string(e);
+            stream += '\n';
+        });
+        return stream;
+    }
+};
+
+} // namespace
+
+bool ParallelLifecycleValidation::Run(std::ostream& out, uint32_t workers) {
+    workers = workers > 1 ? workers : 2;
+
+    // 中途把线程数翻倍：重建后的线程池必须与单线程结果仍然一致
+    const uint32_t resized = workers * 2;
+
+    out << "=== Parallel lifecycle validation (" << kCreatures << " creatures, "
+        << kSteps << " steps, 1 vs " << workers << "->" << resized << " workers) ===" << std::endl;
+
+    LifecycleWorld serial(1);
+    LifecycleWorld parallel(workers);
+
+    double serial_us = 0.0, parallel_us = 0.0;
+    size_t effects = 0;
+    bool identical = true;
+
+    for (uint32_t step = 0; step < kSteps; ++step) {
+        if (step == kSteps / 2) {
+            parallel.scheduler.set_worker_count(resized);
+        }
+
+        std::string expected = serial.step(serial_us);
+        std::string actual = parallel.step(parallel_us);
+        effects += serial.recorder.size();
+
+        if (expected != actual) {
+            out << "  step " << step << ": effect streams differ ("
+                << serial.recorder.size() << " vs " << parallel.recorder.size() << " effects)" << std::endl;
+            identical = false;
+            break;
+        }
+    }
+
+    if (identical && serial.registry.view<component::Lifecycle>() != parallel.registry.view<component::Lifecycle>()) {
+        out << "  surviving creatures differ" << std::endl;
+        identical = false;
+    }
+
+    out << "  effects compared  " << effects << std::endl;
+    out << std::fixed << std::setprecision(1)
+        << "  1 worker          " << serial_us / kSteps << " us/step" << std::endl
+        << "  " << workers << "->" << resized << " workers      " << parallel_us / kSteps << " us/step" << std::endl;
+    out << "\nParallel lifecycle validation " << (identical ? "PASSED" : "FAILED") << std::endl;
+    return identical;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+// ============================================================
+// 并行生命周期Process的确定性验证
+// 同一个世界分别用1个和N个工作线程逐步执行批量生命周期（中途把N翻倍，覆盖线程池重建），
+// 逐tick比较归并后的Effect流，并报告两者的每步耗时
+// ============================================================
+
+class ParallelLifecycleValidation {
+public:
+    // 返回两种线程数下的Effect流是否逐条一致
+    static bool Run(std::ostream& out, uint32_t workers);
+};
@@ -0,0 +1,243 @@
+#include "tools/PopulationBenchmark.h"
+#include "ecs/Registry.h"
+#include "process/ProcessScheduler.h"
+#include "process/PopulationDynamics.h"
+#include "process/Integrator.h"
+#include "components/Components.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <vector>
+
+namespace {
+
+struct Scenario {
+    const char* name;
+    uint32_t region_id;
+    std::vector<std::pair<SpeciesId, uint32_t>> initial;  // 物种 → 初始数量
+};
+
+// 独立的小世界：只在指定Region创建给定的种群
+struct MiniWorld {
+    ecs::Registry registry;
+    ecs::EffectRecorder recorder;
+    SimulationState state;
+    ProcessContext ctx;
+    process::ProcessScheduler scheduler;
+
+    explicit MiniWorld(const Scenario& scenario)
+        : ctx(registry, recorder, state), scheduler(ctx) {
+        state.initialize();
+
+        for (const auto& [species_id, count] : scenario.initial) {
+            auto species_result = state.get_species_template(species_id);
+            if (species_result.is_err()) {
+                continue;
+            }
+            const auto& species = species_result.value().get();
+
+            EntityId pop_id = registry.create_entity(EntityType::Population);
+            registry.add_component(pop_id, component::Population{
+                species.id,
+                scenario.region_id,
+                count,
+                species.base_birth_rate,
+                species.base_death_rate,
+                component::Population::Mode::Simulated,
+                species.limb_length_mean,
+                species.body_mass_mean,
+                species.size_scale_mean,
+                species.limb_length_std,
+                species.body_mass_std,
+                species.size_scale_std,
+                0.0f, 0.0f, 0.0f,  // 性状相关系数（初始独立）
+                0,                 // individual_count
+                0.0f               // count_remainder
+            });
+        }
+    }
+
+    std::vector<uint32_t> counts() const {
+        std::vector<uint32_t> result;
+        for (EntityId pop_id : registry.view<component::Population>()) {
+            result.push_back(registry.get_component<component::Population>(pop_id).estimated_count);
+        }
+        return result;
+    }
+};
+
+double elapsed_us(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 高精度参考解：连续状态、紧容限RK45（不截断为整数）
+std::vector<double> reference_solution(const Scenario& scenario, float elapsed) {
+    MiniWorld world(scenario);
+    process::dynamics::RegionBatch batch;
+    process::dynamics::build_region_batch(world.ctx, scenario.region_id, batch);
+
+    process::dynamics::IntegratorOptions options;
+    options.max_step = 0.5;
+    options.rel_tol = 1e-10;
+    options.abs_tol = 1e-8;
+    options.min_step = 1e-6;
+    process::dynamics::PopulationIntegrator integrator(process::dynamics::IntegratorMode::RK45, options);
+    integrator.integrate(batch, elapsed);
+
+    return batch.count;
+}
+
+double max_relative_error(const std::vector<double>& value, const std::vector<double>& reference) {
+    double err = 0.0;
+    for (size_t i = 0; i < reference.size(); ++i) {
+        err = std::max(err, std::abs(value[i] - reference[i]) / std::max(1.0, reference[i]));
+    }
+    return err;
+}
+
+} // namespace
+
+bool PopulationBenchmark::ValidateFastForward(std::ostream& out) {
+    const std::vector<Scenario> scenarios = {
+        {"logistic (rabbits only)", 1, {{1, 120}}},
+        {"predator-prey (rabbit/wolf/bear)", 2, {{1, 140}, {2, 14}, {3, 7}}},
+    };
+    const float horizons[] = {10.0f, 100.0f, 1000.0f};
+    const double tolerance = 0.01;  // 相对连续模型参考解1%
+
+    bool all_ok = true;
+    out << "=== Fast-forward validation ===" << std::endl;
+    out << "fast-forward is checked against the continuous model (tight RK45 reference);" << std::endl;
+    out << "step-by-step UpdatePopulationGrowth truncates to integers every day and is shown for comparison only" << std::endl;
+
+    for (const auto& scenario : scenarios) {
+        out << "\n[" << scenario.name << "]" << std::endl;
+
+        for (float horizon : horizons) {
+            // 逐步执行UpdatePopulationGrowth（dt=1天）
+            MiniWorld stepped(scenario);
+            auto t0 = std::chrono::steady_clock::now();
+            for (float t = 0.0f; t < horizon; t += 1.0f) {
+                stepped.scheduler.execute_all_population_growth(1.0f);
+            }
+            double stepped_us = elapsed_us(t0);
+
+            // 一次性快进
+            MiniWorld forwarded(scenario);
+            t0 = std::chrono::steady_clock::now();
+            forwarded.scheduler.fast_forward_region(scenario.region_id, horizon);
+            double forward_us = elapsed_us(t0);
+
+            std::vector<double> reference = reference_solution(scenario, horizon);
+            std::vector<uint32_t> stepped_counts = stepped.counts();
+            std::vector<uint32_t> forward_counts = forwarded.counts();
+
+            out << "  t=" << std::fixed << std::setprecision(0) << std::setw(5) << horizon
+                << "  step-by-step " << std::setw(8) << std::setprecision(1) << stepped_us << "us"
+                << "  fast-forward " << std::setw(8) << forward_us << "us" << std::endl;
+
+            for (size_t i = 0; i < reference.size(); ++i) {
+                double err = std::abs(forward_counts[i] - reference[i]) / std::max(1.0, reference[i]);
+                bool ok = err <= tolerance || std::abs(forward_counts[i] - reference[i]) <= 1.0;
+                double stepped_dev = std::abs(stepped_counts[i] - reference[i]) / std::max(1.0, reference[i]);
+                all_ok = all_ok && ok;
+
+                out << "    pop " << i
+                    << "  reference " << std::setw(9) << std::setprecision(2) << reference[i]
+                    << "  fast-forward " << std::setw(7) << forward_counts[i]
+                    << "  err " << std::setprecision(4) << err * 100.0 << "%"
+                    << "  step-by-step " << std::setw(7) << stepped_counts[i]
+                    << " (dev " << std::setprecision(1) << stepped_dev * 100.0 << "%)"
+                    << (ok ? "" : "  <-- FAIL") << std::endl;
+            }
+        }
+    }
+
+    out << "\nFast-forward validation (vs continuous model) " << (all_ok ? "PASSED" : "FAILED") << std::endl;
+    return all_ok;
+}
+
+bool PopulationBenchmark::CompareIntegrators(std::ostream& out) {
+    using process::dynamics::IntegratorMode;
+    using process::dynamics::IntegratorOptions;
+
+    const Scenario scenario{"predator-prey (rabbit/wolf/bear)", 2, {{1, 140}, {2, 14}, {3, 7}}};
+    const float horizon = 200.0f;
+    const int repeats = 200;
+
+    struct Method {
+        const char* label;
+        IntegratorMode mode;
+        double max_step;
+        double rel_tol;
+    };
+    const std::vector<Method> methods = {
+        {"Euler    h=1",        IntegratorMode::Euler, 1.0,   0.0},
+        {"Euler    h=0.1",      IntegratorMode::Euler, 0.1,   0.0},
+        {"RK4      h=1",        IntegratorMode::RK4,   1.0,   0.0},
+        {"RK4      h=5",        IntegratorMode::RK4,   5.0,   0.0},
+        {"RK45     tol=1e-3",   IntegratorMode::RK45,  50.0,  1e-3},
+        {"RK45     tol=1e-5",   IntegratorMode::RK45,  50.0,  1e-5},
+    };
+
+    std::vector<double> reference = reference_solution(scenario, horizon);
+
+    out << "=== Integrator accuracy vs cost (" << scenario.name << ", " << horizon << " days) ===" << std::endl;
+    out << std::left << std::setw(22) << "method" << std::right
+        << std::setw(10) << "steps" << std::setw(10) << "rejected" << std::setw(10) << "f-evals"
+        << std::setw(14) << "max rel err" << std::setw(12) << "us/run" << std::endl;
+
+    // 原有逐种群路径：UpdatePopulationGrowth，dt=1，每步截断为整数
+    {
+        std::vector<double> result;
+        double total_us = 0.0;
+        for (int rep = 0; rep < repeats; ++rep) {
+            MiniWorld world(scenario);
+            auto t0 = std::chrono::steady_clock::now();
+            for (float t = 0.0f; t < horizon; t += 1.0f) {
+                world.scheduler.execute_all_population_growth(1.0f);
+            }
+            total_us += elapsed_us(t0);
+            if (rep == 0) {
+                for (uint32_t c : world.counts()) result.push_back(c);
+            }
+        }
+        double us = total_us / repeats;
+
+        out << std::left << std::setw(22) << "UpdatePopGrowth h=1" << std::right
+            << std::setw(10) << static_cast<int>(horizon) << std::setw(10) << 0 << std::setw(10) << "-"
+            << std::setw(13) << std::fixed << std::setprecision(3) << max_relative_error(result, reference) * 100.0 << "%"
+            << std::setw(12) << std::setprecision(1) << us << std::endl;
+    }
+
+    MiniWorld world(scenario);
+    process::dynamics::RegionBatch initial;
+    process::dynamics::build_region_batch(world.ctx, scenario.region_id, initial);
+
+    for (const auto& method : methods) {
+        IntegratorOptions options;
+        options.max_step = method.max_step;
+        if (method.rel_tol > 0.0) {
+            options.rel_tol = method.rel_tol;
+            options.abs_tol = method.rel_tol * 10.0;
+        }
+
+        process::dynamics::IntegrationStats stats;
+        process::dynamics::RegionBatch batch;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repeats; ++rep) {
+            batch = initial;
+            process::dynamics::PopulationIntegrator integrator(method.mode, options);
+            stats = integrator.integrate(batch, horizon);
+        }
+        double us = elapsed_us(t0) / repeats;
+
+        out << std::left << std::setw(22) << method.label << std::right
+            << std::setw(10) << stats.steps << std::setw(10) << stats.rejected << std::setw(10) << stats.evaluations
+            << std::setw(13) << std::setprecision(3) << max_relative_error(batch.count, reference) * 100.0 << "%"
+            << std::setw(12) << std::setprecision(1) << us << std::endl;
+    }
+
+    return true;
+}
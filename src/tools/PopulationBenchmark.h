@@ -0,0 +1,19 @@
+#pragma once
+
+#include <ostream>
+
+// ============================================================
+// 种群动力学验证与基准工具
+// 在独立的小世界中比较不同积分方式的精度和开销
+// ============================================================
+
+class PopulationBenchmark {
+public:
+    // 验证fast_forward：与连续模型的高精度参考解比较，返回是否在容差内
+    // 逐步执行UpdatePopulationGrowth（dt=1天，每步截断为整数）的结果只作对照输出，
+    // 它与连续模型本就不同，不参与判定
+    static bool ValidateFastForward(std::ostream& out);
+
+    // 比较Euler/RK4/RK45在同一捕食者-猎物场景下的精度和开销
+    static bool CompareIntegrators(std::ostream& out);
+};
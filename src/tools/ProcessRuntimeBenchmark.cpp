@@ -0,0 +1,149 @@
+#include "tools/ProcessRuntimeBenchmark.h"
+#include "ecs/Registry.h"
+#include "process/ProcessScheduler.h"
+#include "core/Random.h"
+#include <chrono>
+#include <iomanip>
+#include <vector>
+
+namespace {
+
+using process::co::SimTask;
+
+constexpr process::co::EventKey kDawnEvent = 1;
+
+const core::Symbol kCraftProgress = core::intern("craft_progress");
+
+struct Counters {
+    uint32_t crafts_done = 0;
+    uint32_t buff_ticks = 0;
+    uint32_t woken = 0;
+};
+
+// 制作工单：等待制作时间后产出一次
+SimTask CraftJob(ProcessContext& ctx, EntityId crafter, double craft_time, Counters& counters) {
+    co_await process::co::delay(craft_time);
+    ctx.record(effect::ResourceChanged{crafter, kCraftProgress, 0.0f, 1.0f});
+    ++counters.crafts_done;
+}
+
+// 持续伤害Buff：每天扣一次血，共ticks次
+SimTask DamageOverTime(ProcessContext& ctx, EntityId target, int ticks, Counters& counters) {
+    float health = 1.0f;
+    for (int i = 0; i < ticks; ++i) {
+        co_await process::co::delay(1.0);
+        ctx.record(effect::ResourceChanged{target, core::sym::Health, health, health - 0.05f});
+        health -= 0.05f;
+        ++counters.buff_ticks;
+    }
+}
+
+// 等待世界事件
+SimTask WaitForDawn(Counters& counters) {
+    co_await process::co::wait_event(kDawnEvent);
+    ++counters.woken;
+}
+
+double elapsed_us(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+bool ProcessRuntimeBenchmark::Run(std::ostream& out) {
+    const uint32_t kCraftJobs = 50000;
+    const uint32_t kBuffs = 1000;
+    const int kBuffTicks = 10;
+    const uint32_t kWaiters = 1000;
+    const float dt = 0.1f;
+    const uint32_t steps = 3000;   // 300天
+    const uint32_t dawn_step = 500;
+
+    ecs::Registry registry;
+    ecs::EffectRecorder recorder;
+    SimulationState state;
+    state.initialize();
+    ProcessContext ctx(registry, recorder, state);
+    process::ProcessScheduler scheduler(ctx);
+
+    Counters counters;
+    std::vector<double> craft_times;
+    craft_times.reserve(kCraftJobs);
+
+    // 制作时间 20~200 天
+    EntityId crafter = ctx.create_entity(EntityType::Creature);
+    for (uint32_t i = 0; i < kCraftJobs; ++i) {
+        core::CounterRng rng(state.world_seed, i, core::RngStream::Lifecycle);
+        craft_times.push_back(rng.uniform(20.0f, 200.0f));
+        scheduler.spawn_process(CraftJob(ctx, crafter, craft_times.back(), counters));
+    }
+    for (uint32_t i = 0; i < kBuffs; ++i) {
+        scheduler.spawn_process(DamageOverTime(ctx, crafter, kBuffTicks, counters));
+    }
+    for (uint32_t i = 0; i < kWaiters; ++i) {
+        scheduler.spawn_process(WaitForDawn(counters));
+    }
+
+    const auto& pool = process::co::FramePool::local();
+    out << "=== Long-running process runtime ===" << std::endl;
+    out << "tasks: " << scheduler.get_runtime().get_live_tasks()
+        << "  frames: " << pool.get_live_frames()
+        << "  pool reserved: " << pool.get_reserved_bytes() / 1024 << " KB" << std::endl;
+
+    // 协程运行时：只恢复到期的任务
+    double runtime_us = 0.0;
+    double dormant_us = 0.0;
+    uint32_t dormant_steps = 0;
+    for (uint32_t step = 0; step < steps; ++step) {
+        recorder.clear();
+        if (step == dawn_step) {
+            scheduler.get_runtime().signal(kDawnEvent);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        scheduler.execute_long_running_processes(dt);
+        double us = elapsed_us(t0);
+        runtime_us += us;
+
+        if (scheduler.get_runtime().get_resumed_last_step() == 0) {
+            dormant_us += us;
+            ++dormant_steps;
+        }
+    }
+
+    // 对照：逐帧轮询所有工单的剩余时间
+    std::vector<double> remaining = craft_times;
+    uint32_t polled_done = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t step = 0; step < steps; ++step) {
+        for (double& r : remaining) {
+            if (r > 0.0) {
+                r -= dt;
+                if (r <= 0.0) {
+                    ++polled_done;
+                }
+            }
+        }
+    }
+    double polling_us = elapsed_us(t0);
+
+    bool ok = counters.crafts_done == kCraftJobs &&
+              counters.buff_ticks == kBuffs * kBuffTicks &&
+              counters.woken == kWaiters &&
+              scheduler.get_runtime().get_live_tasks() == 0 &&
+              polled_done == kCraftJobs;
+
+    out << std::fixed << std::setprecision(2);
+    out << "crafts done " << counters.crafts_done << "/" << kCraftJobs
+        << "  buff ticks " << counters.buff_ticks << "/" << kBuffs * kBuffTicks
+        << "  woken " << counters.woken << "/" << kWaiters << std::endl;
+    out << "coroutine runtime: " << runtime_us / steps << " us/step"
+        << "  (steps with nothing due: " << dormant_steps << ", "
+        << (dormant_steps ? dormant_us / dormant_steps : 0.0) << " us/step)" << std::endl;
+    out << "per-tick polling:  " << polling_us / steps << " us/step" << std::endl;
+    out << "frames still live: " << pool.get_live_frames() << std::endl;
+    out << std::defaultfloat;
+
+    out << "\nProcess runtime benchmark " << (ok ? "PASSED" : "FAILED") << std::endl;
+    return ok;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <ostream>
+
+// ============================================================
+// 长期运行Process（协程运行时）的基准工具
+// 大量休眠的制作工单 + 少量每天触发的Buff + 等待事件的任务，
+// 比较协程运行时与逐帧轮询所有实例的每步开销
+// ============================================================
+
+class ProcessRuntimeBenchmark {
+public:
+    // 运行基准并检查所有任务按时完成，返回是否通过
+    static bool Run(std::ostream& out);
+};
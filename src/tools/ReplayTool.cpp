@@ -0,0 +1,111 @@
+#include "tools/ReplayTool.h"
+#include "components/Components.h"
+#include "export/WorldSnapshot.h"
+#include "process/EffectJournal.h"
+#include "process/WorldStateApplier.h"
+#include <chrono>
+#include <iomanip>
+#include <map>
+
+core::Result<ReplayStats> ReplayTool::Rebuild(const std::string& journal_path,
+                                              const std::string& snapshot_path,
+                                              uint64_t tick,
+                                              ecs::Registry& registry,
+                                              SimulationState& state) {
+    using R = core::Result<ReplayStats>;
+
+    // 1. 最近的关键帧
+    auto keyframe = WorldSnapshotReader::load_nearest(snapshot_path, tick, registry, state);
+    if (keyframe.is_err()) {
+        return R::Err(keyframe.error());
+    }
+
+    ReplayStats stats;
+    stats.keyframe_tick = keyframe.value();
+    stats.reached_tick = stats.keyframe_tick;
+
+    // 2. 应用关键帧之后到目标tick的日志帧
+    // 关键帧之前的帧也要解码（符号定义只在首次出现的帧中）
+    ecs::EffectJournalReader reader;
+    core::ErrorCode open_result = reader.open(journal_path);
+    if (open_result != core::ErrorCode::OK) {
+        return R::Err(open_result);
+    }
+
+    ecs::WorldStateApplier applier(registry, state);
+    ecs::JournalFrame frame;
+    while (true) {
+        auto result = reader.next_frame(frame);
+        if (result.is_err()) {
+            return R::Err(result.error());
+        }
+        if (!result.value() || frame.tick > tick) {
+            break;
+        }
+        if (frame.tick <= stats.keyframe_tick) {
+            continue;
+        }
+
+        applier.apply_frame(frame);
+        stats.reached_tick = frame.tick;
+        ++stats.frames_applied;
+    }
+
+    stats.effects_applied = applier.get_applied();
+    stats.effects_skipped = applier.get_skipped();
+    return R::Ok(std::move(stats));
+}
+
+bool ReplayTool::Seek(const std::string& journal_path, const std::string& snapshot_path,
+                      uint64_t tick, std::ostream& out) {
+    ecs::Registry registry;
+    SimulationState state;
+    state.initialize();
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = Rebuild(journal_path, snapshot_path, tick, registry, state);
+    double elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    if (result.is_err()) {
+        out << "Replay failed: " << core::error_code_to_string(result.error()) << std::endl;
+        return false;
+    }
+    const auto& stats = result.value();
+
+    out << "=== Replay: tick " << tick << " ===" << std::endl;
+    out << "  keyframe tick:   " << stats.keyframe_tick << std::endl;
+    out << "  frames applied:  " << stats.frames_applied << std::endl;
+    out << "  effects applied: " << stats.effects_applied
+        << " (skipped " << stats.effects_skipped << ")" << std::endl;
+    out << "  rebuild time:    " << std::fixed << std::setprecision(2) << elapsed_ms << " ms" << std::endl;
+    if (stats.reached_tick < tick) {
+        out << "  warning: journal ends at tick " << stats.reached_tick << std::endl;
+    }
+
+    out << "\n  t=" << std::setprecision(1) << state.current_time
+        << " | entities: " << registry.get_all_entities().size() << std::endl;
+
+    // Region模式与各种群数量
+    for (const auto& [region_id, region] : state.get_all_regions()) {
+        out << "  [" << region.name << "] " << region_mode_name(region.mode);
+        for (EntityId pop_id : registry.view<component::Population>()) {
+            const auto& pop = registry.get_component<component::Population>(pop_id);
+            if (pop.region_id == region_id) {
+                out << " | species " << pop.species_id << ": " << pop.estimated_count;
+            }
+        }
+        out << std::endl;
+    }
+
+    // 个体按Region统计
+    std::map<uint32_t, uint32_t> creatures_per_region;
+    for (EntityId cid : registry.view<component::Position>()) {
+        ++creatures_per_region[registry.get_component<component::Position>(cid).region_id];
+    }
+    for (const auto& [region_id, count] : creatures_per_region) {
+        out << "  creatures in region " << region_id << ": " << count << std::endl;
+    }
+
+    return true;
+}
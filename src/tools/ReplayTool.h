@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ecs/Registry.h"
+#include "simulation/SimulationState.h"
+#include "core/Result.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// ============================================================
+// 回放定位工具：最近关键帧 + Effect日志 → 任意tick的世界状态
+// 不运行任何Process，代价与关键帧之后的日志量成正比，
+// 用于排查线上不同步：直接查看出问题那一步的状态，无需从t=0重新模拟。
+// ============================================================
+
+struct ReplayStats {
+    uint64_t keyframe_tick = 0;    // 加载的关键帧
+    uint64_t reached_tick = 0;     // 实际到达的tick（日志不足时小于目标）
+    uint64_t frames_applied = 0;
+    uint64_t effects_applied = 0;
+    uint64_t effects_skipped = 0;  // 目标实体不存在的Effect
+};
+
+class ReplayTool {
+public:
+    // 把registry/state重建到tick结束时的状态（state需已initialize）
+    static core::Result<ReplayStats> Rebuild(const std::string& journal_path,
+                                             const std::string& snapshot_path,
+                                             uint64_t tick,
+                                             ecs::Registry& registry,
+                                             SimulationState& state);
+
+    // 定位到tick并输出世界摘要，返回是否成功
+    static bool Seek(const std::string& journal_path, const std::string& snapshot_path,
+                     uint64_t tick, std::ostream& out);
+};